@@ -0,0 +1,48 @@
+#include "AllocationTracker.h"
+
+#ifdef DEBUG
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    thread_local int t_noAllocDepth = 0;
+    std::atomic<unsigned int> g_violations{0};
+    std::atomic<unsigned int> g_lastViolationSize{0};
+
+    void* TrackedAllocate(std::size_t size) {
+        if (t_noAllocDepth > 0) {
+            g_violations++;
+            g_lastViolationSize = (unsigned int)size;
+        }
+        return std::malloc(size ? size : 1);
+    }
+}
+
+namespace AllocationTracker {
+    void EnterNoAllocScope() { t_noAllocDepth++; }
+    void LeaveNoAllocScope() { t_noAllocDepth--; }
+    unsigned int Violations() { return g_violations; }
+    unsigned int LastViolationSize() { return g_lastViolationSize; }
+}
+
+void* operator new(std::size_t size) {
+    if (void* p = TrackedAllocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* p = TrackedAllocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+#endif
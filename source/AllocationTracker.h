@@ -0,0 +1,32 @@
+#pragma once
+// ============================================================================
+// AllocationTracker - debug-build check that the frame path stays off the heap
+// ============================================================================
+//
+// Debug builds replace the module's global operator new/delete and count every
+// allocation made while a NoAllocScope is active on the calling thread. The
+// count is shown on the debug overlay. Release builds compile this to nothing.
+
+namespace AllocationTracker {
+
+#ifdef DEBUG
+    void EnterNoAllocScope();
+    void LeaveNoAllocScope();
+    unsigned int Violations();
+    unsigned int LastViolationSize();
+
+    struct NoAllocScope {
+        NoAllocScope() { EnterNoAllocScope(); }
+        ~NoAllocScope() { LeaveNoAllocScope(); }
+        NoAllocScope(const NoAllocScope&) = delete;
+        NoAllocScope& operator=(const NoAllocScope&) = delete;
+    };
+#else
+    struct NoAllocScope {
+        NoAllocScope() {}   // User-provided, so an unused scope variable does not warn
+    };
+    inline unsigned int Violations() { return 0; }
+    inline unsigned int LastViolationSize() { return 0; }
+#endif
+
+} // namespace AllocationTracker
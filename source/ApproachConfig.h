@@ -0,0 +1,28 @@
+#pragma once
+// ============================================================================
+// ApproachConfig - approach autosave tuning
+// ============================================================================
+//
+// Shared by source/Main.cpp and tests/BlipTrackerTest.cpp, so the host tests
+// replay the mod's real ranges and cooldowns.
+
+#include "BlipTracker.h"
+
+namespace Config {
+    constexpr unsigned int AUTOSAVE_COOLDOWN_MS = 15000;
+    constexpr float MISSION_BLIP_DETECTION_RANGE = 10.0f;          // Enter radius
+    constexpr float MISSION_BLIP_EXIT_RANGE = 14.0f;               // Exit radius (hysteresis band above the enter radius)
+    constexpr float MISSION_BLIP_MATCH_DISTANCE = 1.0f;            // Traces closer than this are treated as the same blip
+    constexpr unsigned int PER_BLIP_COOLDOWN_MS = 120000;          // Same blip, same mission state: no re-save before this
+    constexpr unsigned int TRACKED_BLIP_FORGET_MS = 60000;         // Forget blips not seen for this long
+    constexpr int MAX_TRACKED_BLIPS = 16;
+
+    constexpr BlipTracker::Params APPROACH_BLIP_PARAMS = {
+        MISSION_BLIP_DETECTION_RANGE,
+        MISSION_BLIP_EXIT_RANGE,
+        MISSION_BLIP_MATCH_DISTANCE,
+        AUTOSAVE_COOLDOWN_MS,
+        PER_BLIP_COOLDOWN_MS,
+        TRACKED_BLIP_FORGET_MS,
+    };
+}
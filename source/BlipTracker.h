@@ -0,0 +1,182 @@
+#pragma once
+// ============================================================================
+// BlipTracker - per-blip enter/exit hysteresis for approach autosaves
+// ============================================================================
+//
+// Independent of the game so it can be replayed by tests/BlipTrackerTest.cpp.
+//
+// Each frame the caller reports every mission-giver trace with Observe(), then
+// calls Update() with the player position. A blip is entered inside the enter
+// radius and only left outside the exit radius, and keeps its state while its
+// trace briefly drops out of use. An enter edge makes an approach save pending
+// unless the same blip was saved recently with the same mission state, another
+// approach save is within the global cooldown, or a save is already pending.
+// The save stays pending until RecordSave() or ClearPending().
+
+#include "FixedArena.h"
+
+namespace BlipTracker {
+
+    struct Params {
+        float enterRange;                 // Enter radius
+        float exitRange;                  // Exit radius (hysteresis band above the enter radius)
+        float matchDistance;              // Traces closer than this are treated as the same blip
+        unsigned int globalCooldownMs;    // Any blip: no approach save before this
+        unsigned int perBlipCooldownMs;   // Same blip, same mission state: no re-save before this
+        unsigned int forgetMs;            // Forget blips not seen for this long
+    };
+
+    struct Blip {
+        float x = 0.0f;
+        float y = 0.0f;
+        bool inside = false;              // Between enter and exit: inside until the exit radius is crossed
+        unsigned int lastSeenTime = 0;    // Last frame the trace was observed
+        bool hasSaved = false;
+        unsigned int lastSaveTime = 0;
+        int missionsPassedAtSave = 0;
+    };
+
+    template <int Capacity>
+    class Tracker {
+    public:
+        explicit Tracker(const Params& params) : m_params(params) {}
+
+        void Reset() {
+            m_blips.Clear();
+            m_insideCount = 0;
+            m_pendingSlot = -1;
+            m_lastSaveTime = 0;
+        }
+
+        // Records a mission-giver trace this frame; traces beyond the exit radius are ignored
+        void Observe(float x, float y, float playerX, float playerY, unsigned int currentTime) {
+            float dx = playerX - x;
+            float dy = playerY - y;
+            if (dx * dx + dy * dy >= m_params.exitRange * m_params.exitRange) return;
+
+            int slot = FindOrAdd(x, y, currentTime);
+            if (slot >= 0) {
+                m_blips[slot].lastSeenTime = currentTime;
+            }
+        }
+
+        // Updates enter/exit state from the player position; an enter edge may make
+        // an approach save pending. Enter edges blocked by a gate, or while a save is
+        // already pending, are added to outSuppressed.
+        void Update(float playerX, float playerY, unsigned int currentTime, int missionsPassed,
+                    bool canBeNearBlip, bool allowTrigger, unsigned int& outSuppressed) {
+            float enterRangeSq = m_params.enterRange * m_params.enterRange;
+            float exitRangeSq = m_params.exitRange * m_params.exitRange;
+            m_insideCount = 0;
+
+            for (int i = 0; i < m_blips.CAPACITY; i++) {
+                if (!m_blips.IsUsed(i)) continue;
+                Blip& blip = m_blips[i];
+
+                float dx = playerX - blip.x;
+                float dy = playerY - blip.y;
+                float distSq = dx * dx + dy * dy;
+
+                if (!canBeNearBlip || distSq >= exitRangeSq) {
+                    blip.inside = false;
+                } else if (!blip.inside && distSq < enterRangeSq && blip.lastSeenTime == currentTime) {
+                    blip.inside = true;
+
+                    bool blipAllowsSave = !blip.hasSaved ||
+                                          missionsPassed != blip.missionsPassedAtSave ||
+                                          !IsInCooldown(blip, currentTime);
+                    bool globalAllowsSave = currentTime > m_lastSaveTime + m_params.globalCooldownMs;
+
+                    // One pending save at a time; a second blip entered alongside it counts as suppressed
+                    if (allowTrigger && blipAllowsSave && globalAllowsSave && m_pendingSlot < 0) {
+                        m_pendingSlot = i;
+                    } else if (allowTrigger) {
+                        outSuppressed++;
+                    }
+                }
+
+                if (blip.inside) {
+                    m_insideCount++;
+                } else if (CanForget(i, currentTime)) {
+                    m_blips.Release(i);
+                }
+            }
+        }
+
+        bool HasPending() const { return m_pendingSlot >= 0; }
+        void ClearPending() { m_pendingSlot = -1; }
+
+        // The pending save was written: starts the per-blip and global cooldowns
+        void RecordSave(unsigned int currentTime, int missionsPassed) {
+            if (m_pendingSlot < 0) return;
+
+            Blip& blip = m_blips[m_pendingSlot];
+            blip.hasSaved = true;
+            blip.lastSaveTime = currentTime;
+            blip.missionsPassedAtSave = missionsPassed;
+            m_pendingSlot = -1;
+            m_lastSaveTime = currentTime;
+        }
+
+        // Holds off approach saves for the global cooldown without a save (loaded next to a blip)
+        void StartGlobalCooldown(unsigned int currentTime) { m_lastSaveTime = currentTime; }
+
+        int InsideCount() const { return m_insideCount; }
+        int Count() const { return m_blips.Count(); }
+
+    private:
+        bool IsInCooldown(const Blip& blip, unsigned int currentTime) const {
+            return blip.hasSaved && currentTime <= blip.lastSaveTime + m_params.perBlipCooldownMs;
+        }
+
+        // A saved blip is kept for its whole cooldown, otherwise walking out of range
+        // and back after forgetMs would save it again
+        bool CanForget(int slot, unsigned int currentTime) const {
+            const Blip& blip = m_blips[slot];
+            return !blip.inside && slot != m_pendingSlot &&
+                   currentTime > blip.lastSeenTime + m_params.forgetMs &&
+                   !IsInCooldown(blip, currentTime);
+        }
+
+        int FindOrAdd(float x, float y, unsigned int currentTime) {
+            float matchSq = m_params.matchDistance * m_params.matchDistance;
+            int oldestSlot = -1;
+            for (int i = 0; i < m_blips.CAPACITY; i++) {
+                if (!m_blips.IsUsed(i)) continue;
+                const Blip& blip = m_blips[i];
+
+                float dx = blip.x - x;
+                float dy = blip.y - y;
+                if (dx * dx + dy * dy < matchSq) {
+                    return i;
+                }
+
+                if (!blip.inside && i != m_pendingSlot && !IsInCooldown(blip, currentTime) &&
+                    (oldestSlot < 0 || blip.lastSeenTime < m_blips[oldestSlot].lastSeenTime)) {
+                    oldestSlot = i;
+                }
+            }
+
+            // Pool full: evict the blip seen longest ago that the player is not standing
+            // in and that is not holding a save cooldown; if none, retry next frame
+            int slot = m_blips.Acquire();
+            if (slot < 0 && oldestSlot >= 0) {
+                m_blips.Release(oldestSlot);
+                slot = m_blips.Acquire();
+            }
+            if (slot < 0) return -1;
+
+            m_blips[slot].x = x;
+            m_blips[slot].y = y;
+            m_blips[slot].lastSeenTime = currentTime;
+            return slot;
+        }
+
+        Params m_params;
+        FixedPool<Blip, Capacity> m_blips;
+        int m_insideCount = 0;
+        int m_pendingSlot = -1;
+        unsigned int m_lastSaveTime = 0;
+    };
+
+} // namespace BlipTracker
@@ -0,0 +1,106 @@
+#pragma once
+// ============================================================================
+// FixedArena / FixedPool - fixed-capacity storage for the per-frame path
+// ============================================================================
+//
+// Everything OnGameProcess and OnDrawHud touch must be reserved up front:
+// buffers come from a FixedArena reserved at init and rewound after use,
+// runtime records live in a FixedPool. Neither grows; running out is reported
+// to the caller instead of falling back to the heap.
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+class FixedArena {
+public:
+    FixedArena() = default;
+    FixedArena(const FixedArena&) = delete;
+    FixedArena& operator=(const FixedArena&) = delete;
+    ~FixedArena() { delete[] m_buffer; }
+
+    // Allocates the backing buffer. Call once, outside the frame loop.
+    bool Reserve(size_t capacity) {
+        if (m_buffer) return m_capacity >= capacity;
+        m_buffer = new (std::nothrow) uint8_t[capacity];
+        m_capacity = m_buffer ? capacity : 0;
+        m_used = 0;
+        return m_buffer != nullptr;
+    }
+
+    // Returns nullptr when the arena is exhausted or was never reserved
+    uint8_t* Allocate(size_t size, size_t alignment = 16) {
+        size_t start = (m_used + alignment - 1) & ~(alignment - 1);
+        if (!m_buffer || start > m_capacity || size > m_capacity - start) return nullptr;
+
+        m_used = start + size;
+        if (m_used > m_highWater) m_highWater = m_used;
+        return m_buffer + start;
+    }
+
+    size_t Mark() const { return m_used; }
+    void Rewind(size_t mark) { if (mark <= m_used) m_used = mark; }
+
+    size_t Capacity() const { return m_capacity; }
+    size_t HighWater() const { return m_highWater; }
+
+private:
+    uint8_t* m_buffer = nullptr;
+    size_t m_capacity = 0;
+    size_t m_used = 0;
+    size_t m_highWater = 0;
+};
+
+// Releases everything allocated from the arena during its lifetime
+class ArenaScope {
+public:
+    explicit ArenaScope(FixedArena& arena) : m_arena(arena), m_mark(arena.Mark()) {}
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ~ArenaScope() { m_arena.Rewind(m_mark); }
+
+private:
+    FixedArena& m_arena;
+    size_t m_mark;
+};
+
+// Fixed number of T slots addressed by index; Acquire() returns -1 when full
+template <typename T, int Capacity>
+class FixedPool {
+public:
+    static constexpr int CAPACITY = Capacity;
+
+    int Acquire() {
+        for (int i = 0; i < Capacity; i++) {
+            if (!m_used[i]) {
+                m_used[i] = true;
+                m_items[i] = T();
+                m_count++;
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    void Release(int index) {
+        if (!m_used[index]) return;
+        m_used[index] = false;
+        m_count--;
+    }
+
+    void Clear() {
+        for (int i = 0; i < Capacity; i++) m_used[i] = false;
+        m_count = 0;
+    }
+
+    bool IsUsed(int index) const { return m_used[index]; }
+    int Count() const { return m_count; }
+
+    T& operator[](int index) { return m_items[index]; }
+    const T& operator[](int index) const { return m_items[index]; }
+
+private:
+    T m_items[Capacity] = {};
+    bool m_used[Capacity] = {};
+    int m_count = 0;
+};
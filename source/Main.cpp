@@ -22,20 +22,29 @@
 #include <CMessages.h>
 #include <extensions/Config.h>
 #include <extensions/Screen.h>
+#include <shlobj.h>
+#include <chrono>
+#include "SaveCompression.h"
+#include "Metrics.h"
+#include "FixedArena.h"
+#include "AllocationTracker.h"
+#include "ApproachConfig.h"
 
 using namespace plugin;
 
 // ============================================================================
 // Configuration Constants
 // ============================================================================
+// Approach autosave ranges and cooldowns are in ApproachConfig.h
 namespace Config {
-    constexpr unsigned int AUTOSAVE_COOLDOWN_MS = 15000;
-    constexpr float MISSION_BLIP_DETECTION_RANGE = 10.0f;
     constexpr float MISSION_BLIP_ROTATION_RANGE = 15.0f;
-    constexpr unsigned int POST_LOAD_GRACE_PERIOD_MS = 500;
     constexpr unsigned int AUTOSAVE_DISPLAY_DURATION_MS = 3000;
     constexpr int MISSION_COMPLETE_SAVE_SLOT = 6;  // Autosave on mission complete
     constexpr int MISSION_RETRY_SAVE_SLOT = 7;     // Autosave near mission marker for retry
+    constexpr const char* PACKED_SLOT_EXTENSION = ".az";  // Compressed slot container next to the native file
+    constexpr size_t MAX_SLOT_FILE_SIZE = 512 * 1024;     // Larger slot files are left uncompressed
+    constexpr const char* METRICS_MAPPING_NAME = "Local\\" TARGET_NAME ".Metrics";
+    constexpr float METRICS_PHASE_AVERAGE_WEIGHT = 0.05f;
 }
 
 // ============================================================================
@@ -57,6 +66,14 @@ namespace Utils {
 #endif
     }
 
+    int GetMissionsPassed() {
+#ifdef GTASA
+        return (int)CStats::GetStatValue(STAT_MISSIONS_PASSED);
+#else
+        return CStats::MissionsPassed;
+#endif
+    }
+
     bool IsCutsceneRunning() {
         return CCutsceneMgr::ms_running;
     }
@@ -355,23 +372,195 @@ namespace Utils {
 
 } // namespace Utils
 
+// ============================================================================
+// Slot Storage - optional compressed containers for the autosave slots
+// ============================================================================
+//
+// Runs from the frame loop (after an autosave, before a retry load), so it
+// does Win32 file I/O directly and takes every buffer from the caller's arena.
+namespace SlotStorage {
+
+    struct Result {
+        size_t rawSize = 0;
+        size_t packedSize = 0;
+        double elapsedMs = 0.0;
+        uint64_t nativeWriteTime = 0;   // Set by UnpackSlot: write time of the native file it wrote
+    };
+
+    // Arena capacity that covers a pack or an unpack of the largest slot file
+    constexpr size_t ARENA_SIZE = Config::MAX_SLOT_FILE_SIZE + SaveCompression::MaxContainerSize(Config::MAX_SLOT_FILE_SIZE) + 64;
+
+    // Native slot file path, e.g. "Documents\GTA3 User Files\GTA3sf8.b" for slot 7
+    bool GetSlotFilePath(int slot, char* out, size_t outSize) {
+        char documents[MAX_PATH];
+        if (FAILED(SHGetFolderPathA(nullptr, CSIDL_PERSONAL, nullptr, 0, documents))) return false;
+
+#ifdef GTA3
+        int len = sprintf_s(out, outSize, "%s\\GTA3 User Files\\GTA3sf%d.b", documents, slot + 1);
+#elif defined(GTAVC)
+        int len = sprintf_s(out, outSize, "%s\\GTA Vice City User Files\\GTAVCsf%d.b", documents, slot + 1);
+#elif defined(GTASA)
+        int len = sprintf_s(out, outSize, "%s\\GTA San Andreas User Files\\GTASAsf%d.b", documents, slot + 1);
+#endif
+        return len > 0;
+    }
+
+    void GetPackedPath(const char* nativePath, char* out, size_t outSize) {
+        sprintf_s(out, outSize, "%s%s", nativePath, Config::PACKED_SLOT_EXTENSION);
+    }
+
+    bool GetWriteTime(const char* path, uint64_t& outWriteTime) {
+        WIN32_FILE_ATTRIBUTE_DATA info;
+        if (!GetFileAttributesExA(path, GetFileExInfoStandard, &info)) return false;
+        outWriteTime = (uint64_t(info.ftLastWriteTime.dwHighDateTime) << 32) | info.ftLastWriteTime.dwLowDateTime;
+        return true;
+    }
+
+    // Reads a file of at most maxSize bytes into arena memory. Returns nullptr on failure.
+    uint8_t* ReadWholeFile(const char* path, size_t maxSize, FixedArena& arena, size_t& outSize) {
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return nullptr;
+
+        uint8_t* data = nullptr;
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0 && (uint64_t)size.QuadPart <= maxSize) {
+            DWORD bytesRead = 0;
+            data = arena.Allocate((size_t)size.QuadPart);
+            if (data && (!ReadFile(file, data, (DWORD)size.QuadPart, &bytesRead, nullptr) || bytesRead != (DWORD)size.QuadPart)) {
+                data = nullptr;
+            }
+            outSize = (size_t)size.QuadPart;
+        }
+        CloseHandle(file);
+        return data;
+    }
+
+    // Writes to a temporary file first so a crash never leaves a truncated slot behind
+    bool WriteWholeFile(const char* path, const uint8_t* data, size_t size) {
+        char tempPath[MAX_PATH + 16];
+        sprintf_s(tempPath, sizeof(tempPath), "%s.tmp", path);
+
+        HANDLE file = CreateFileA(tempPath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        DWORD bytesWritten = 0;
+        bool ok = WriteFile(file, data, (DWORD)size, &bytesWritten, nullptr) && bytesWritten == (DWORD)size;
+        ok = CloseHandle(file) && ok;
+
+        if (!ok || !MoveFileExA(tempPath, path, MOVEFILE_REPLACE_EXISTING)) {
+            DeleteFileA(tempPath);
+            return false;
+        }
+        return true;
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Replaces the native slot file with a compressed container
+    bool PackSlot(int slot, FixedArena& arena, Result& out) {
+        char nativePath[MAX_PATH], packedPath[MAX_PATH + 8];
+        if (!GetSlotFilePath(slot, nativePath, sizeof(nativePath))) return false;
+        GetPackedPath(nativePath, packedPath, sizeof(packedPath));
+
+        ArenaScope scope(arena);
+        size_t rawSize = 0;
+        const uint8_t* raw = ReadWholeFile(nativePath, Config::MAX_SLOT_FILE_SIZE, arena, rawSize);
+        if (!raw) return false;
+
+        auto start = std::chrono::steady_clock::now();
+        size_t packedCapacity = SaveCompression::MaxContainerSize(rawSize);
+        uint8_t* packed = arena.Allocate(packedCapacity);
+        size_t packedSize = packed ? SaveCompression::Compress(raw, rawSize, packed, packedCapacity) : 0;
+        out.elapsedMs = ElapsedMs(start);
+        out.rawSize = rawSize;
+        out.packedSize = packedSize;
+
+        if (packedSize == 0 || !WriteWholeFile(packedPath, packed, packedSize)) return false;
+        DeleteFileA(nativePath);
+        return true;
+    }
+
+    // Restores the native slot file from its container unless a newer native file exists.
+    // Returns true when the native file is present afterwards.
+    bool UnpackSlot(int slot, FixedArena& arena, Result& out) {
+        char nativePath[MAX_PATH], packedPath[MAX_PATH + 8];
+        if (!GetSlotFilePath(slot, nativePath, sizeof(nativePath))) return false;
+        GetPackedPath(nativePath, packedPath, sizeof(packedPath));
+
+        uint64_t nativeWriteTime = 0, packedWriteTime = 0;
+        bool hasNative = GetWriteTime(nativePath, nativeWriteTime);
+        if (!GetWriteTime(packedPath, packedWriteTime)) return hasNative;
+        if (hasNative && nativeWriteTime > packedWriteTime) return true;
+
+        ArenaScope scope(arena);
+        size_t packedSize = 0;
+        const uint8_t* packed = ReadWholeFile(packedPath, SaveCompression::MaxContainerSize(Config::MAX_SLOT_FILE_SIZE), arena, packedSize);
+        if (!packed) return hasNative;
+
+        auto start = std::chrono::steady_clock::now();
+        size_t rawSize = 0;
+        uint8_t* raw = nullptr;
+        bool ok = SaveCompression::ReadRawSize(packed, packedSize, rawSize) && rawSize <= Config::MAX_SLOT_FILE_SIZE;
+        if (ok) {
+            raw = arena.Allocate(rawSize);
+            ok = raw && SaveCompression::Decompress(packed, packedSize, raw, rawSize);
+        }
+        out.elapsedMs = ElapsedMs(start);
+        out.rawSize = rawSize;
+        out.packedSize = packedSize;
+
+        if (!ok || !WriteWholeFile(nativePath, raw, rawSize)) return hasNative;
+        GetWriteTime(nativePath, out.nativeWriteTime);
+        return true;
+    }
+
+    // Removes a native file written by UnpackSlot, unless something rewrote it since
+    void DiscardUnpackedSlot(int slot, uint64_t unpackedWriteTime) {
+        char nativePath[MAX_PATH], packedPath[MAX_PATH + 8];
+        if (!GetSlotFilePath(slot, nativePath, sizeof(nativePath))) return;
+        GetPackedPath(nativePath, packedPath, sizeof(packedPath));
+
+        uint64_t nativeWriteTime = 0, packedWriteTime = 0;
+        if (!GetWriteTime(packedPath, packedWriteTime) || !GetWriteTime(nativePath, nativeWriteTime)) return;
+        if (nativeWriteTime == unpackedWriteTime) {
+            DeleteFileA(nativePath);
+        }
+    }
+
+    // Leaves only the native file (compression switched off)
+    void RestoreSlot(int slot, FixedArena& arena) {
+        char nativePath[MAX_PATH], packedPath[MAX_PATH + 8];
+        if (!GetSlotFilePath(slot, nativePath, sizeof(nativePath))) return;
+        GetPackedPath(nativePath, packedPath, sizeof(packedPath));
+
+        Result result;
+        uint64_t packedWriteTime = 0;
+        if (GetWriteTime(packedPath, packedWriteTime) && UnpackSlot(slot, arena, result)) {
+            DeleteFileA(packedPath);
+        }
+    }
+
+} // namespace SlotStorage
+
 // ============================================================================
 // AutosaveMod Class - Main mod logic
 // ============================================================================
 class AutosaveMod {
 public:
     AutosaveMod() {
-        Events::initGameEvent += []{ Instance().OnGameInit(); };
-        Events::gameProcessEvent += []{ Instance().OnGameProcess(); };
-        Events::drawHudEvent += []{ Instance().OnDrawHud(); };
+        s_instance = this;
+        Events::initGameEvent += []{ s_instance->OnGameInit(); };
+        Events::reInitGameEvent += []{ s_instance->OnGameReInit(); };
+        Events::gameProcessEvent += []{ s_instance->OnGameProcess(); };
+        Events::drawHudEvent += []{ s_instance->OnDrawHud(); };
     }
 
 private:
-    // Singleton access for event callbacks
-    static AutosaveMod& Instance() {
-        static AutosaveMod instance;
-        return instance;
-    }
+    // The instance the event callbacks forward to (autosaveModInstance below). A
+    // function-local static here would construct a second instance whose
+    // constructor registers every handler again.
+    static inline AutosaveMod* s_instance = nullptr;
 
     // ========================================================================
     // Configuration
@@ -380,22 +569,24 @@ private:
         bool debugMode = false;
         bool approachAutosaveEnabled = true;
         bool missionCompleteAutosaveEnabled = true;
+        bool compressAutosaves = false;
+        bool publishMetrics = false;
     } m_settings;
 
     // ========================================================================
     // State tracking
     // ========================================================================
     
-    // Load detection
-    bool m_justLoaded = false;
-    unsigned int m_loadedAtTime = 0;
-    unsigned int m_lastGameTime = 0;
+    // Load detection - bumped by the game's own init/reinit, handled once on the next frame
+    unsigned int m_loadGeneration = 0;
+    unsigned int m_handledLoadGeneration = 0;
+
+    // Per-blip memory for approach autosaves, keyed by blip position; owns the
+    // pending approach save and its cooldowns
+    BlipTracker::Tracker<Config::MAX_TRACKED_BLIPS> m_blipTracker{ Config::APPROACH_BLIP_PARAMS };
 
     // Autosave state
-    bool m_wasNearMissionBlip = false;
-    unsigned int m_lastNearBlipAutosaveTime = 0;  // Independent cooldown for near-marker saves
     unsigned int m_lastMissionCompleteAutosaveTime = 0;  // Independent cooldown for mission complete saves
-    bool m_pendingAutosave = false;
     bool m_pendingMissionCompleteSave = false;
     unsigned int m_autosaveDisplayUntil = 0;  // Shared display timer (only one notification at a time)
 
@@ -407,6 +598,14 @@ private:
     bool m_retryYKeyWasPressed = false;
     bool m_retryNKeyWasPressed = false;
 
+    // Compressed slot storage
+    FixedArena m_slotArena;                 // Reserved once at init; the frame loop never touches the heap
+    uint64_t m_unpackedRetrySlotWriteTime = 0;  // Native retry slot expanded for a load, removed after it
+
+    // Shared-memory metrics for external monitoring
+    Metrics::Mapping m_metricsMapping;
+    Metrics::Data m_metrics = {};
+
     // Debug
     char m_debugText[256] = "";
     char m_saveDebugText[256] = "";
@@ -418,23 +617,40 @@ private:
     
     void OnGameInit() {
         LoadConfig();
-        ResetLoadState();
-        m_autosaveDisplayUntil = 0;
+        m_loadGeneration++;
+        m_slotArena.Reserve(SlotStorage::ARENA_SIZE);
+        SyncSlotStorage();
+
+        if (m_settings.publishMetrics && !m_metricsMapping.Get()) {
+            m_metricsMapping.Create(Config::METRICS_MAPPING_NAME);
+        }
     }
 
     void OnGameProcess() {
+        AllocationTracker::NoAllocScope noAlloc;
         unsigned int currentTime = CTimer::m_snTimeInMilliseconds;
-        
-        DetectGameLoad(currentTime);
-        HandlePostLoadState(currentTime);
+
+        // Phase timing reads the clock once per phase, so it only runs while metrics are published
+        bool timePhases = m_metricsMapping.Get() != nullptr;
+        std::chrono::steady_clock::time_point phaseStart;
+        if (timePhases) phaseStart = std::chrono::steady_clock::now();
+
+        if (m_handledLoadGeneration != m_loadGeneration) {
+            HandleGameLoaded(currentTime);
+        }
+        if (timePhases) RecordPhaseCost(Metrics::PHASE_POST_LOAD, phaseStart);
         HandleAutosave(currentTime);
+        if (timePhases) RecordPhaseCost(Metrics::PHASE_AUTOSAVE, phaseStart);
         HandleMissionRetry(currentTime);
+        if (timePhases) RecordPhaseCost(Metrics::PHASE_MISSION_RETRY, phaseStart);
         UpdateDebugInfo(currentTime);
+        if (timePhases) RecordPhaseCost(Metrics::PHASE_DEBUG_INFO, phaseStart);
 
-        m_lastGameTime = currentTime;
+        PublishMetrics(currentTime);
     }
 
     void OnDrawHud() {
+        AllocationTracker::NoAllocScope noAlloc;
         DrawDebugInfo();
         DrawAutosaveNotification();
         DrawRetryPrompt();
@@ -449,6 +665,8 @@ private:
         m_settings.debugMode = config["Debug"].asInt(0) != 0;
         m_settings.approachAutosaveEnabled = config["ApproachAutosave"].asInt(1) != 0;
         m_settings.missionCompleteAutosaveEnabled = config["MissionCompleteAutosave"].asInt(1) != 0;
+        m_settings.compressAutosaves = config["CompressAutosaves"].asInt(0) != 0;
+        m_settings.publishMetrics = config["PublishMetrics"].asInt(0) != 0;
 
         bool needSave = false;
         if (config["Debug"].isEmpty()) {
@@ -463,6 +681,14 @@ private:
             config["MissionCompleteAutosave"] = 1;
             needSave = true;
         }
+        if (config["CompressAutosaves"].isEmpty()) {
+            config["CompressAutosaves"] = 0;
+            needSave = true;
+        }
+        if (config["PublishMetrics"].isEmpty()) {
+            config["PublishMetrics"] = 0;
+            needSave = true;
+        }
         if (needSave) {
             config.save();
         }
@@ -471,43 +697,44 @@ private:
     // ========================================================================
     // Load Detection & State Reset
     // ========================================================================
-    
-    void ResetLoadState() {
-        m_justLoaded = true;
-        m_loadedAtTime = 0;
-    }
 
-    void DetectGameLoad(unsigned int currentTime) {
-        if (m_lastGameTime > 0 && currentTime < m_lastGameTime) {
-            ResetLoadState();
-            m_autosaveDisplayUntil = 0;
-        }
+    // Runs inside the game's restart routine (new game, menu load, retry load),
+    // before the save has been read, so the reset itself waits for the next frame
+    void OnGameReInit() {
+        m_loadGeneration++;
     }
 
-    // ========================================================================
-    // Post-Load Handling (Rotation & Autosave Prevention)
-    // ========================================================================
-    
-    void HandlePostLoadState(unsigned int currentTime) {
-        if (!m_justLoaded) return;
-
-        bool isNearBlip = !Utils::IsOnMission() && 
-                          !Utils::IsCutsceneRunning() && 
-                          Utils::IsPlayerNearMissionBlip(Config::MISSION_BLIP_DETECTION_RANGE);
+    // One-shot reset after a load: every timestamp from the previous session is
+    // meaningless against the restored game timer
+    void HandleGameLoaded(unsigned int currentTime) {
+        m_handledLoadGeneration = m_loadGeneration;
+        m_metrics.gamesLoaded++;
 
-        if (m_loadedAtTime == 0) {
-            m_loadedAtTime = currentTime;
-
-            // Prevent immediate autosave
-            m_wasNearMissionBlip = isNearBlip;
-            m_lastNearBlipAutosaveTime = isNearBlip ? currentTime : 0;
-
-            // Rotate player to face nearest mission blip
-            RotatePlayerToNearestBlip();
+        m_pendingMissionCompleteSave = false;
+        for (Metrics::SlotCounters& counters : m_metrics.slots) {
+            counters.consecutiveFailures = 0;
         }
+        m_lastMissionCompleteAutosaveTime = 0;
+        m_autosaveDisplayUntil = 0;
+        m_saveDebugDisplayUntil = 0;
+        ResetMissionRetryState(Utils::GetMissionsPassed());
+
+        // Seed blip memory without triggering: a blip the player was loaded into
+        // is already inside and only fires again after leaving its exit radius
+        m_blipTracker.Reset();
+        bool canBeNearBlip = !Utils::IsOnMission() && !Utils::IsCutsceneRunning();
+        UpdateTrackedBlips(currentTime, canBeNearBlip, false);
+        if (m_blipTracker.InsideCount() > 0) {
+            m_blipTracker.StartGlobalCooldown(currentTime);
+        }
+
+        // Rotate player to face nearest mission blip
+        RotatePlayerToNearestBlip();
 
-        if (currentTime > m_loadedAtTime + Config::POST_LOAD_GRACE_PERIOD_MS) {
-            m_justLoaded = false;
+        // The load has consumed the expanded retry slot
+        if (m_unpackedRetrySlotWriteTime != 0) {
+            SlotStorage::DiscardUnpackedSlot(Config::MISSION_RETRY_SAVE_SLOT, m_unpackedRetrySlotWriteTime);
+            m_unpackedRetrySlotWriteTime = 0;
         }
     }
 
@@ -531,40 +758,62 @@ private:
         if (!m_settings.approachAutosaveEnabled) return;
 
         bool isOnMission = Utils::IsOnMission();
-        bool isNearBlip = !isOnMission &&
-                          !Utils::IsCutsceneRunning() &&
-                          Utils::IsPlayerNearMissionBlip(Config::MISSION_BLIP_DETECTION_RANGE);
-
-        // Trigger pending save when entering blip area (with cooldown)
-        if (!m_justLoaded && isNearBlip && !m_wasNearMissionBlip) {
-            if (currentTime > m_lastNearBlipAutosaveTime + Config::AUTOSAVE_COOLDOWN_MS) {
-                m_pendingAutosave = true;
-            }
-        }
+        bool canBeNearBlip = !isOnMission && !Utils::IsCutsceneRunning();
 
-        if (!m_justLoaded) {
-            m_wasNearMissionBlip = isNearBlip;
-        }
+        // Entering a blip area makes a save pending (per-blip gate plus global cooldown)
+        UpdateTrackedBlips(currentTime, canBeNearBlip, true);
 
         // Cancel if mission starts
         if (isOnMission) {
-            m_pendingAutosave = false;
+            if (m_blipTracker.HasPending()) {
+                m_metrics.slots[Metrics::SLOT_MISSION_RETRY].skipped++;
+            }
+            m_blipTracker.ClearPending();
+            m_metrics.slots[Metrics::SLOT_MISSION_RETRY].consecutiveFailures = 0;
         }
 
         // Execute autosave when safe
-        if (m_pendingAutosave && Utils::IsGameSafeToSave()) {
+        if (m_blipTracker.HasPending() && Utils::IsGameSafeToSave()) {
             if (PerformAutosave(currentTime, Config::MISSION_RETRY_SAVE_SLOT)) {
-                m_pendingAutosave = false;  // Only clear pending flag if save succeeded
+                m_blipTracker.RecordSave(currentTime, Utils::GetMissionsPassed());  // Only clears pending if save succeeded
             }
-            // If save failed, keep m_pendingAutosave true to retry on next frame
+            // If save failed, the save stays pending to retry on next frame
         }
     }
 
+    // ========================================================================
+    // Per-Blip Tracking (Hysteresis)
+    // ========================================================================
+
+    // Feeds the mission-giver traces to the blip tracker and updates enter/exit
+    // state; an enter edge may make an approach save pending
+    void UpdateTrackedBlips(unsigned int currentTime, bool canBeNearBlip, bool allowTrigger) {
+        CPlayerPed* player = Utils::GetPlayer();
+        if (!player) return;
+
+        CVector playerPos = player->GetPosition();
+
+#ifdef GTASA
+        int traceCount = (int)MAX_RADAR_TRACES;
+#else
+        int traceCount = 32;
+#endif
+        for (int i = 0; i < traceCount; i++) {
+            const tRadarTrace& blip = CRadar::ms_RadarTrace[i];
+            if (!blip.m_bInUse || !Utils::IsMissionGiverSprite(blip.m_nRadarSprite)) continue;
+            m_blipTracker.Observe(blip.m_vecPos.x, blip.m_vecPos.y, playerPos.x, playerPos.y, currentTime);
+        }
+
+        m_blipTracker.Update(playerPos.x, playerPos.y, currentTime, Utils::GetMissionsPassed(),
+                             canBeNearBlip, allowTrigger, m_metrics.slots[Metrics::SLOT_MISSION_RETRY].skipped);
+    }
+
     bool PerformAutosave(unsigned int currentTime, int slot) {
         // Preserve game time (saving normally advances clock by 6 hours)
         unsigned char savedHours = CClock::ms_nGameClockHours;
         unsigned char savedMinutes = CClock::ms_nGameClockMinutes;
         unsigned short savedSeconds = CClock::ms_nGameClockSeconds;
+        auto saveStart = std::chrono::steady_clock::now();
 
         // Attempt to save - check return value
 #ifdef GTASA
@@ -573,6 +822,7 @@ private:
 #else
         bool saveSuccess = PcSaveHelper.SaveSlot(slot);
 #endif
+        double saveDurationMs = SlotStorage::ElapsedMs(saveStart);
 
         // Restore game time
         CClock::ms_nGameClockHours = savedHours;
@@ -588,11 +838,9 @@ private:
 #endif
 
         if (shouldShowNotification) {
-            // Update the appropriate cooldown timer based on slot
+            // Mission complete cooldown (approach saves start theirs in the blip tracker)
             if (slot == Config::MISSION_COMPLETE_SAVE_SLOT) {
                 m_lastMissionCompleteAutosaveTime = currentTime;
-            } else if (slot == Config::MISSION_RETRY_SAVE_SLOT) {
-                m_lastNearBlipAutosaveTime = currentTime;
             }
 
             // Always update display timer
@@ -604,8 +852,14 @@ private:
                          m_autosaveDisplayUntil, currentTime);
                 m_saveDebugDisplayUntil = currentTime + 2000;
             }
+
+            if (m_settings.compressAutosaves && slot == Config::MISSION_RETRY_SAVE_SLOT) {
+                PackSavedSlot(currentTime, slot);
+            }
         }
 
+        RecordSaveMetrics(currentTime, slot, shouldShowNotification, saveDurationMs);
+
 #ifdef GTAVC
         return shouldShowNotification;
 #else
@@ -614,19 +868,82 @@ private:
     }
 
     // ========================================================================
-    // Mission Retry Feature
+    // Compressed Slot Storage
     // ========================================================================
-    
-    void HandleMissionRetry(unsigned int currentTime) {
+
+    // Brings the retry slot in line with the setting: pack a leftover native file when
+    // enabled, expand the container back to a native file when disabled. The mission
+    // complete slot is loaded from the game's own menu, so it always stays native.
+    void SyncSlotStorage() {
+        SlotStorage::RestoreSlot(Config::MISSION_COMPLETE_SAVE_SLOT, m_slotArena);
+
+        if (m_settings.compressAutosaves) {
+            SlotStorage::Result result;
+            bool packed = SlotStorage::PackSlot(Config::MISSION_RETRY_SAVE_SLOT, m_slotArena, result);
+            if (result.rawSize > 0) {
+                RecordCompressionMetrics(m_metrics.pack, Config::MISSION_RETRY_SAVE_SLOT, packed, result);
+            }
+        } else {
+            SlotStorage::RestoreSlot(Config::MISSION_RETRY_SAVE_SLOT, m_slotArena);
+        }
+    }
+
+    void PackSavedSlot(unsigned int currentTime, int slot) {
+        SlotStorage::Result result;
+        bool packed = SlotStorage::PackSlot(slot, m_slotArena, result);
+        if (result.rawSize == 0) return;
+
+        RecordCompressionMetrics(m_metrics.pack, slot, packed, result);
+        if (m_settings.debugMode) {
+            sprintf_s(m_saveDebugText, sizeof(m_saveDebugText), "%s slot %d: %u -> %u bytes (%.1f%%) in %.2f ms",
+                     packed ? "PACKED" : "PACK FAILED", slot, (unsigned int)result.rawSize, (unsigned int)result.packedSize,
+                     100.0 * (double)result.packedSize / (double)result.rawSize, result.elapsedMs);
+            m_saveDebugDisplayUntil = currentTime + 2000;
+        }
+    }
+
+    // Makes sure the native retry slot exists; returns the write time to discard it with later (0 = nothing expanded)
+    uint64_t UnpackRetrySlot() {
+        if (!m_settings.compressAutosaves) return 0;
+
+        SlotStorage::Result result;
+        SlotStorage::UnpackSlot(Config::MISSION_RETRY_SAVE_SLOT, m_slotArena, result);
+        if (result.packedSize == 0) return 0;
+
+        RecordCompressionMetrics(m_metrics.unpack, Config::MISSION_RETRY_SAVE_SLOT, result.nativeWriteTime != 0, result);
+        if (m_settings.debugMode) {
+            unsigned int currentTime = CTimer::m_snTimeInMilliseconds;
+            sprintf_s(m_saveDebugText, sizeof(m_saveDebugText), "UNPACKED slot %d: %u -> %u bytes in %.2f ms",
+                     Config::MISSION_RETRY_SAVE_SLOT, (unsigned int)result.packedSize, (unsigned int)result.rawSize,
+                     result.elapsedMs);
+            m_saveDebugDisplayUntil = currentTime + 2000;
+        }
+        return result.nativeWriteTime;
+    }
+
+    bool IsRetrySlotValid() {
+        uint64_t unpackedWriteTime = UnpackRetrySlot();
 #ifdef GTASA
-        int missionsPassed = (int)CStats::GetStatValue(STAT_MISSIONS_PASSED);
+        bool valid = CGenericGameStorage::CheckSlotDataValid(Config::MISSION_RETRY_SAVE_SLOT, false);
 #else
-        int missionsPassed = CStats::MissionsPassed;
+        bool valid = CheckSlotDataValid(Config::MISSION_RETRY_SAVE_SLOT);
 #endif
+        if (unpackedWriteTime != 0) {
+            SlotStorage::DiscardUnpackedSlot(Config::MISSION_RETRY_SAVE_SLOT, unpackedWriteTime);
+        }
+        return valid;
+    }
+
+    // ========================================================================
+    // Mission Retry Feature
+    // ========================================================================
+    
+    void HandleMissionRetry(unsigned int currentTime) {
+        int missionsPassed = Utils::GetMissionsPassed();
         bool isOnMission = Utils::IsOnMission();
 
-        // Reset on load/new game
-        if (m_justLoaded || m_lastMissionsPassed == -1 || missionsPassed < m_lastMissionsPassed) {
+        // Reset on first run or if the counter went back without a load event
+        if (m_lastMissionsPassed == -1 || missionsPassed < m_lastMissionsPassed) {
             ResetMissionRetryState(missionsPassed);
         }
 
@@ -642,12 +959,8 @@ private:
         // GTA III/SA: Show prompt whenever mission failed text appears (simple and reliable)
         if (missionFailedTextVisible && !m_wasMissionFailedTextVisible) {
             // Mission failed text just appeared - show retry prompt if we have a save
-#ifdef GTASA
-            if (CGenericGameStorage::CheckSlotDataValid(Config::MISSION_RETRY_SAVE_SLOT, false)) {
-#else
-            if (CheckSlotDataValid(Config::MISSION_RETRY_SAVE_SLOT)) {
-#endif
-                m_showRetryPrompt = true;
+            if (IsRetrySlotValid()) {
+                ShowRetryPrompt();
             }
         }
 #elif defined(GTAVC)
@@ -655,8 +968,8 @@ private:
         // If player was on mission, is now off mission, and mission count didn't increase -> mission failed
         if (m_wasOnMission && !isOnMission && missionsPassed == m_lastMissionsPassed) {
             // Mission ended without success - show retry prompt if we have a save
-            if (CheckSlotDataValid(Config::MISSION_RETRY_SAVE_SLOT)) {
-                m_showRetryPrompt = true;
+            if (IsRetrySlotValid()) {
+                ShowRetryPrompt();
             }
         }
 #endif
@@ -701,6 +1014,7 @@ private:
 
         if (yPressed && !m_retryYKeyWasPressed) {
             LoadAutosave();
+            m_metrics.retryPromptsAccepted++;
             m_showRetryPrompt = false;
         }
         else if (nPressed && !m_retryNKeyWasPressed) {
@@ -712,6 +1026,8 @@ private:
     }
 
     void LoadAutosave() {
+        m_unpackedRetrySlotWriteTime = UnpackRetrySlot();
+
 #ifdef GTA3
         MakeValidSaveName(Config::MISSION_RETRY_SAVE_SLOT);
         FrontEndMenuManager.m_nCurrentSaveSlot = Config::MISSION_RETRY_SAVE_SLOT;
@@ -728,6 +1044,88 @@ private:
 #endif
     }
 
+    void ShowRetryPrompt() {
+        if (!m_showRetryPrompt) {
+            m_metrics.retryPromptsShown++;
+        }
+        m_showRetryPrompt = true;
+    }
+
+    // ========================================================================
+    // Metrics
+    // ========================================================================
+
+    // Records the time since phaseStart as the cost of a phase and restarts the clock
+    void RecordPhaseCost(Metrics::Phase phase, std::chrono::steady_clock::time_point& phaseStart) {
+        auto now = std::chrono::steady_clock::now();
+        float costUs = std::chrono::duration<float, std::micro>(now - phaseStart).count();
+        float& average = m_metrics.phaseCostAvgUs[phase];
+
+        m_metrics.phaseCostUs[phase] = costUs;
+        average += (costUs - average) * Config::METRICS_PHASE_AVERAGE_WEIGHT;
+        phaseStart = now;
+    }
+
+    void RecordSaveMetrics(unsigned int currentTime, int slot, bool succeeded, double saveDurationMs) {
+        Metrics::SlotIndex index = (slot == Config::MISSION_COMPLETE_SAVE_SLOT)
+            ? Metrics::SLOT_MISSION_COMPLETE
+            : Metrics::SLOT_MISSION_RETRY;
+        Metrics::SlotCounters& counters = m_metrics.slots[index];
+
+        // Retries of a failing pending save count once in attempted and failed
+        bool firstCall = counters.consecutiveFailures == 0;
+        if (firstCall) {
+            counters.attempted++;
+        } else {
+            counters.retries++;
+        }
+
+        if (succeeded) {
+            counters.succeeded++;
+            counters.consecutiveFailures = 0;
+        } else {
+            if (firstCall) counters.failed++;
+            counters.consecutiveFailures++;
+        }
+
+        m_metrics.lastSaveSlot = (uint32_t)slot;
+        m_metrics.lastSaveGameTimeMs = currentTime;
+        m_metrics.lastSaveDurationMs = (float)saveDurationMs;
+    }
+
+    void RecordCompressionMetrics(Metrics::CompressionCounters& counters, int slot, bool succeeded,
+                                  const SlotStorage::Result& result) {
+        if (!succeeded) {
+            counters.failed++;
+            return;
+        }
+
+        float durationMs = (float)result.elapsedMs;
+        counters.succeeded++;
+        counters.lastSlot = (uint32_t)slot;
+        counters.lastRawSize = (uint32_t)result.rawSize;
+        counters.lastPackedSize = (uint32_t)result.packedSize;
+        counters.lastDurationMs = durationMs;
+        if (durationMs > counters.maxDurationMs) counters.maxDurationMs = durationMs;
+        counters.totalRawBytes += result.rawSize;
+        counters.totalPackedBytes += result.packedSize;
+    }
+
+    void PublishMetrics(unsigned int currentTime) {
+        Metrics::SharedBlock* block = m_metricsMapping.Get();
+        if (!block) return;
+
+        m_metrics.frameCount++;
+        m_metrics.gameTimeMs = currentTime;
+        m_metrics.pendingApproachSave = m_blipTracker.HasPending();
+        m_metrics.pendingMissionCompleteSave = m_pendingMissionCompleteSave;
+        m_metrics.retryPromptVisible = m_showRetryPrompt;
+        m_metrics.slotArenaHighWater = (uint32_t)m_slotArena.HighWater();
+        m_metrics.slotArenaCapacity = (uint32_t)m_slotArena.Capacity();
+
+        Metrics::Publish(*block, m_metrics);
+    }
+
     // ========================================================================
     // Debug & HUD Drawing
     // ========================================================================
@@ -736,16 +1134,13 @@ private:
         if (!m_settings.debugMode) return;
 
         bool nearBlip = Utils::IsPlayerNearMissionBlip(Config::MISSION_BLIP_DETECTION_RANGE);
-#ifdef GTASA
-        int missionsPassed = (int)CStats::GetStatValue(STAT_MISSIONS_PASSED);
-#else
-        int missionsPassed = CStats::MissionsPassed;
-#endif
+        int missionsPassed = Utils::GetMissionsPassed();
         bool isOnMission = Utils::IsOnMission();
         bool missionFailedVisible = Utils::IsMissionFailedTextVisible();
 
-        sprintf_s(m_debugText, sizeof(m_debugText), "near=%d load=%d miss=%d onmiss=%d failtxt=%d",
-            nearBlip, m_justLoaded, missionsPassed, isOnMission, missionFailedVisible);
+        sprintf_s(m_debugText, sizeof(m_debugText), "near=%d in=%d gen=%u miss=%d onmiss=%d failtxt=%d allocs=%u (last %u B)",
+            nearBlip, m_blipTracker.InsideCount(), m_loadGeneration, missionsPassed, isOnMission, missionFailedVisible,
+            AllocationTracker::Violations(), AllocationTracker::LastViolationSize());
     }
 
     void DrawDebugInfo() {
@@ -0,0 +1,217 @@
+#pragma once
+// ============================================================================
+// Metrics - fixed-layout autosave health block in named shared memory
+// ============================================================================
+//
+// The mod fills a Metrics::Data snapshot during the frame and publishes it once
+// per frame with Publish(). Readers copy it out with Read(). The block is
+// guarded by a seqlock: the writer never waits, readers retry while a write is
+// in progress (odd sequence) or if the sequence changed during their copy.
+//
+// Shared with tools/MetricsReader.cpp, so it must not depend on the game.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Metrics {
+
+    constexpr uint32_t MAGIC = 0x584D5341;  // "ASMX"
+    constexpr uint32_t VERSION = 1;   // Bump when Data changes after a release
+
+    // Indexes into Data::slots
+    enum SlotIndex : uint32_t {
+        SLOT_MISSION_COMPLETE = 0,
+        SLOT_MISSION_RETRY,
+        SLOT_COUNT
+    };
+
+    // Per-frame phases of AutosaveMod::OnGameProcess
+    enum Phase : uint32_t {
+        PHASE_POST_LOAD = 0,   // Does work only on the frame after a load
+        PHASE_AUTOSAVE,
+        PHASE_MISSION_RETRY,
+        PHASE_DEBUG_INFO,
+        PHASE_COUNT
+    };
+
+    // A pending save that fails is retried every frame until it succeeds or is
+    // cancelled; it still counts once in attempted and failed.
+    struct SlotCounters {
+        uint32_t attempted;             // Pending saves that reached a save call
+        uint32_t succeeded;
+        uint32_t skipped;               // Triggers suppressed by a cooldown or cancelled before saving
+        uint32_t failed;                // Pending saves whose first save call reported failure
+        uint32_t retries;               // Save calls after a failure for the same pending save
+        uint32_t consecutiveFailures;   // Gauge: failed calls for the current pending save, 0 when none
+    };
+
+    // Slot file packing (CompressAutosaves), one set for packs and one for unpacks.
+    // Only operations that found a file to convert are counted.
+    struct CompressionCounters {
+        uint32_t succeeded;
+        uint32_t failed;
+        uint32_t lastSlot;
+        uint32_t lastRawSize;         // Native slot file bytes
+        uint32_t lastPackedSize;      // Container bytes
+        float lastDurationMs;         // Compress/decompress time, excluding file I/O
+        float maxDurationMs;
+        uint64_t totalRawBytes;       // Over succeeded operations
+        uint64_t totalPackedBytes;
+    };
+
+    struct Data {
+        uint64_t frameCount;
+        uint32_t gameTimeMs;
+
+        SlotCounters slots[SLOT_COUNT];
+        uint32_t lastSaveSlot;
+        uint32_t lastSaveGameTimeMs;
+        float lastSaveDurationMs;
+
+        float phaseCostUs[PHASE_COUNT];       // Last frame
+        float phaseCostAvgUs[PHASE_COUNT];    // Exponential moving average
+
+        uint32_t retryPromptsShown;
+        uint32_t retryPromptsAccepted;
+        uint32_t gamesLoaded;              // Load events handled (new game, menu load, retry load)
+
+        CompressionCounters pack;
+        CompressionCounters unpack;
+        uint32_t slotArenaHighWater;       // Peak pack/unpack scratch use
+        uint32_t slotArenaCapacity;        // Scratch reserved at init
+
+        uint8_t pendingApproachSave;
+        uint8_t pendingMissionCompleteSave;
+        uint8_t retryPromptVisible;
+    };
+
+    struct SharedBlock {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t size;                      // sizeof(SharedBlock), to catch layout mismatches
+        std::atomic<uint32_t> sequence;     // Odd while a write is in progress
+        Data data;
+    };
+
+    static_assert(std::is_standard_layout<SharedBlock>::value, "SharedBlock is shared across processes");
+    static_assert(std::is_trivially_copyable<Data>::value, "Data is copied with memcpy");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Sequence must be lock-free in shared memory");
+
+    inline void Publish(SharedBlock& block, const Data& data) {
+        uint32_t sequence = block.sequence.load(std::memory_order_relaxed);
+        block.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&block.data, &data, sizeof(Data));
+        block.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Returns false if no consistent copy was obtained within maxAttempts
+    inline bool Read(const SharedBlock& block, Data& out, int maxAttempts = 1000) {
+        if (block.magic != MAGIC || block.version != VERSION || block.size != sizeof(SharedBlock)) return false;
+
+        for (int attempt = 0; attempt < maxAttempts; attempt++) {
+            uint32_t before = block.sequence.load(std::memory_order_acquire);
+            if (before & 1) continue;
+
+            memcpy(&out, const_cast<const Data*>(&block.data), sizeof(Data));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (block.sequence.load(std::memory_order_relaxed) == before) return true;
+        }
+        return false;
+    }
+
+    // ========================================================================
+    // Named shared memory mapping (Windows file mapping / POSIX shm)
+    // ========================================================================
+    class Mapping {
+    public:
+        Mapping() = default;
+        Mapping(const Mapping&) = delete;
+        Mapping& operator=(const Mapping&) = delete;
+        ~Mapping() { Close(); }
+
+        // Creates (or reuses) the block and stamps its header
+        bool Create(const char* name) {
+            if (!Map(name, true)) return false;
+            m_block->magic = MAGIC;
+            m_block->version = VERSION;
+            m_block->size = sizeof(SharedBlock);
+            return true;
+        }
+
+        bool Open(const char* name) {
+            return Map(name, false);
+        }
+
+        SharedBlock* Get() const { return m_block; }
+
+        void Close() {
+            if (!m_block) return;
+#ifdef _WIN32
+            UnmapViewOfFile(m_block);
+            CloseHandle(m_handle);
+            m_handle = nullptr;
+#else
+            munmap(m_block, sizeof(SharedBlock));
+            if (m_owner) shm_unlink(m_name);
+#endif
+            m_block = nullptr;
+        }
+
+    private:
+        bool Map(const char* name, bool create) {
+            Close();
+#ifdef _WIN32
+            m_handle = create
+                ? CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(SharedBlock), name)
+                : OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+            if (!m_handle) return false;
+
+            void* view = MapViewOfFile(m_handle, create ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, sizeof(SharedBlock));
+            if (!view) {
+                CloseHandle(m_handle);
+                m_handle = nullptr;
+                return false;
+            }
+#else
+            int fd = shm_open(name, create ? (O_CREAT | O_RDWR) : O_RDONLY, 0644);
+            if (fd < 0) return false;
+            if (create && ftruncate(fd, sizeof(SharedBlock)) != 0) {
+                close(fd);
+                return false;
+            }
+
+            void* view = mmap(nullptr, sizeof(SharedBlock), create ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+            close(fd);
+            if (view == MAP_FAILED) return false;
+
+            m_owner = create;
+            snprintf(m_name, sizeof(m_name), "%s", name);
+#endif
+            m_block = static_cast<SharedBlock*>(view);
+            return true;
+        }
+
+        SharedBlock* m_block = nullptr;
+#ifdef _WIN32
+        HANDLE m_handle = nullptr;
+#else
+        bool m_owner = false;
+        char m_name[128] = "";
+#endif
+    };
+
+} // namespace Metrics
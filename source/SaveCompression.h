@@ -0,0 +1,272 @@
+#pragma once
+// ============================================================================
+// SaveCompression - streaming block container for autosave slot files
+// ============================================================================
+//
+// Independent of the game so it can be shared with the Linux tools.
+//
+// Container layout (little endian):
+//   header  : "ASZ1", u32 rawSize, u32 blockSize, u32 blockCount
+//   per block: u32 storedSize (top bit set = stored uncompressed), u32 rawSize,
+//              u32 FNV-1a checksum of the raw bytes, then storedSize bytes
+//
+// Blocks use an LZ4-style sequence format (token, literals, 16-bit offset,
+// match length) and never reference data outside their own block, so they
+// can be encoded in any order (see tools/CompressBench.cpp).
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace SaveCompression {
+
+    constexpr uint32_t BLOCK_SIZE = 64 * 1024;
+    constexpr size_t HEADER_SIZE = 16;
+    constexpr size_t BLOCK_HEADER_SIZE = 12;
+    constexpr uint32_t STORED_RAW_FLAG = 0x80000000u;
+
+    inline uint32_t Checksum(const uint8_t* data, size_t size) {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < size; i++) {
+            hash ^= data[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    namespace Detail {
+        constexpr int HASH_BITS = 12;
+        constexpr size_t MIN_MATCH = 4;
+        constexpr size_t LAST_LITERALS = 5;     // Trailing bytes always emitted as literals
+        constexpr size_t MIN_BLOCK_TO_COMPRESS = 13;
+        constexpr size_t MAX_OFFSET = 65535;
+
+        inline uint32_t Read32(const uint8_t* p) {
+            uint32_t v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        inline void WriteLE32(uint8_t* p, uint32_t v) {
+            p[0] = (uint8_t)v;
+            p[1] = (uint8_t)(v >> 8);
+            p[2] = (uint8_t)(v >> 16);
+            p[3] = (uint8_t)(v >> 24);
+        }
+
+        inline uint32_t ReadLE32(const uint8_t* p) {
+            return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+        }
+
+        inline uint32_t Hash(uint32_t sequence) {
+            return (sequence * 2654435761u) >> (32 - HASH_BITS);
+        }
+
+        inline uint8_t* WriteLength(uint8_t* op, size_t length) {
+            while (length >= 255) {
+                *op++ = 255;
+                length -= 255;
+            }
+            *op++ = (uint8_t)length;
+            return op;
+        }
+
+        inline uint8_t* WriteSequence(uint8_t* op, const uint8_t* literals, size_t literalCount,
+                                      size_t offset, size_t matchLength) {
+            uint8_t* token = op++;
+            *token = (uint8_t)((literalCount >= 15 ? 15 : literalCount) << 4);
+            if (literalCount >= 15) op = WriteLength(op, literalCount - 15);
+            memcpy(op, literals, literalCount);
+            op += literalCount;
+
+            if (matchLength == 0) return op;  // Final literal-only sequence
+
+            op[0] = (uint8_t)offset;
+            op[1] = (uint8_t)(offset >> 8);
+            op += 2;
+
+            size_t code = matchLength - MIN_MATCH;
+            *token |= (uint8_t)(code >= 15 ? 15 : code);
+            if (code >= 15) op = WriteLength(op, code - 15);
+            return op;
+        }
+
+        inline bool ReadLength(const uint8_t*& ip, const uint8_t* end, size_t& length) {
+            uint8_t b;
+            do {
+                if (ip >= end) return false;
+                b = *ip++;
+                length += b;
+            } while (b == 255);
+            return true;
+        }
+
+        // Worst case output for a block that does not compress at all
+        constexpr size_t BlockBound(size_t size) {
+            return size + size / 255 + 16;
+        }
+
+        // Returns the compressed size; dst must hold BlockBound(size) bytes
+        inline size_t CompressBlock(const uint8_t* src, size_t size, uint8_t* dst) {
+            uint8_t* op = dst;
+            size_t anchor = 0;
+
+            if (size >= MIN_BLOCK_TO_COMPRESS) {
+                uint32_t table[1 << HASH_BITS] = {};  // Position + 1, 0 = empty
+                const size_t matchLimit = size - LAST_LITERALS;
+                const size_t scanLimit = size - LAST_LITERALS - MIN_MATCH;
+                size_t ip = 0;
+
+                while (ip < scanLimit) {
+                    uint32_t sequence = Read32(src + ip);
+                    uint32_t h = Hash(sequence);
+                    size_t candidate = table[h];
+                    table[h] = (uint32_t)(ip + 1);
+
+                    if (candidate == 0 || ip - (candidate - 1) > MAX_OFFSET ||
+                        Read32(src + candidate - 1) != sequence) {
+                        ip++;
+                        continue;
+                    }
+
+                    size_t ref = candidate - 1;
+                    size_t length = MIN_MATCH;
+                    while (ip + length < matchLimit && src[ref + length] == src[ip + length]) length++;
+
+                    op = WriteSequence(op, src + anchor, ip - anchor, ip - ref, length);
+                    ip += length;
+                    anchor = ip;
+                }
+            }
+
+            op = WriteSequence(op, src + anchor, size - anchor, 0, 0);
+            return (size_t)(op - dst);
+        }
+
+        // Returns false on malformed input or if the output does not exactly fill dst
+        inline bool DecompressBlock(const uint8_t* src, size_t size, uint8_t* dst, size_t rawSize) {
+            const uint8_t* ip = src;
+            const uint8_t* end = src + size;
+            size_t op = 0;
+
+            while (ip < end) {
+                uint8_t token = *ip++;
+
+                size_t literalCount = token >> 4;
+                if (literalCount == 15 && !ReadLength(ip, end, literalCount)) return false;
+                if (literalCount > (size_t)(end - ip) || literalCount > rawSize - op) return false;
+                memcpy(dst + op, ip, literalCount);
+                ip += literalCount;
+                op += literalCount;
+
+                if (ip == end) break;  // Final literal-only sequence
+
+                if (end - ip < 2) return false;
+                size_t offset = size_t(ip[0]) | size_t(ip[1]) << 8;
+                ip += 2;
+                if (offset == 0 || offset > op) return false;
+
+                size_t matchLength = token & 15;
+                if (matchLength == 15 && !ReadLength(ip, end, matchLength)) return false;
+                matchLength += MIN_MATCH;
+                if (matchLength > rawSize - op) return false;
+
+                // Byte copy: the match may overlap the bytes it produces
+                for (size_t i = 0; i < matchLength; i++, op++) dst[op] = dst[op - offset];
+            }
+            return op == rawSize;
+        }
+
+        inline void WriteHeader(uint8_t* dst, size_t rawSize, size_t blocks) {
+            memcpy(dst, "ASZ1", 4);
+            WriteLE32(dst + 4, (uint32_t)rawSize);
+            WriteLE32(dst + 8, BLOCK_SIZE);
+            WriteLE32(dst + 12, (uint32_t)blocks);
+        }
+
+        // Writes block header and payload to out, which must hold
+        // BLOCK_HEADER_SIZE + BlockBound(rawSize) bytes. Returns the bytes written.
+        inline size_t EncodeBlock(const uint8_t* block, size_t rawSize, uint8_t* out) {
+            uint8_t* payload = out + BLOCK_HEADER_SIZE;
+            uint32_t stored = (uint32_t)CompressBlock(block, rawSize, payload);
+            if (stored >= rawSize) {
+                memcpy(payload, block, rawSize);
+                stored = (uint32_t)rawSize | STORED_RAW_FLAG;
+            }
+
+            WriteLE32(out, stored);
+            WriteLE32(out + 4, (uint32_t)rawSize);
+            WriteLE32(out + 8, Checksum(block, rawSize));
+            return BLOCK_HEADER_SIZE + (stored & ~STORED_RAW_FLAG);
+        }
+    } // namespace Detail
+
+    constexpr size_t BlockCount(size_t rawSize) {
+        return (rawSize + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    }
+
+    // Size a destination buffer must have for Compress() to always succeed
+    constexpr size_t MaxContainerSize(size_t rawSize) {
+        size_t blocks = BlockCount(rawSize);
+        return HEADER_SIZE + blocks * BLOCK_HEADER_SIZE + rawSize + rawSize / 255 + blocks * 16;
+    }
+
+    // Returns the container size, or 0 if dstCapacity is below MaxContainerSize(size)
+    inline size_t Compress(const uint8_t* src, size_t size, uint8_t* dst, size_t dstCapacity) {
+        if (dstCapacity < MaxContainerSize(size) || size > 0x7FFFFFFFu) return 0;
+
+        size_t blocks = BlockCount(size);
+        Detail::WriteHeader(dst, size, blocks);
+
+        uint8_t* op = dst + HEADER_SIZE;
+        for (size_t b = 0; b < blocks; b++) {
+            size_t rawSize = (b + 1 < blocks) ? BLOCK_SIZE : size - b * BLOCK_SIZE;
+            op += Detail::EncodeBlock(src + b * BLOCK_SIZE, rawSize, op);
+        }
+        return (size_t)(op - dst);
+    }
+
+    // Reads the original size from a container header
+    inline bool ReadRawSize(const uint8_t* src, size_t size, size_t& outRawSize) {
+        if (size < HEADER_SIZE || memcmp(src, "ASZ1", 4) != 0) return false;
+        outRawSize = Detail::ReadLE32(src + 4);
+        return true;
+    }
+
+    // Returns false on a malformed container, a checksum mismatch or a too small dst
+    inline bool Decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t dstCapacity) {
+        size_t rawSize = 0;
+        if (!ReadRawSize(src, size, rawSize) || rawSize > dstCapacity) return false;
+        if (Detail::ReadLE32(src + 8) != BLOCK_SIZE) return false;
+
+        size_t blocks = Detail::ReadLE32(src + 12);
+        if (blocks != BlockCount(rawSize)) return false;
+
+        const uint8_t* ip = src + HEADER_SIZE;
+        const uint8_t* end = src + size;
+        size_t op = 0;
+        for (size_t b = 0; b < blocks; b++) {
+            if ((size_t)(end - ip) < BLOCK_HEADER_SIZE) return false;
+            uint32_t stored = Detail::ReadLE32(ip);
+            size_t blockRawSize = Detail::ReadLE32(ip + 4);
+            uint32_t checksum = Detail::ReadLE32(ip + 8);
+            ip += BLOCK_HEADER_SIZE;
+
+            size_t storedSize = stored & ~STORED_RAW_FLAG;
+            if (storedSize > (size_t)(end - ip) || blockRawSize > rawSize - op) return false;
+
+            if (stored & STORED_RAW_FLAG) {
+                if (storedSize != blockRawSize) return false;
+                memcpy(dst + op, ip, blockRawSize);
+            } else if (!Detail::DecompressBlock(ip, storedSize, dst + op, blockRawSize)) {
+                return false;
+            }
+
+            if (Checksum(dst + op, blockRawSize) != checksum) return false;
+            ip += storedSize;
+            op += blockRawSize;
+        }
+        return op == rawSize;
+    }
+
+} // namespace SaveCompression
@@ -0,0 +1,234 @@
+// ============================================================================
+// BlipTrackerTest - trace-driven replay of the approach autosave hysteresis
+// ============================================================================
+//
+// Replays player/radar traces frame by frame through source/BlipTracker.h, with
+// the mod's own ranges and cooldowns from source/ApproachConfig.h, calling it the
+// way AutosaveMod::HandleAutosave does. Checks how many approach saves each trace
+// produces: boundary jitter, blips entered together, the global cooldown, trace
+// flicker, mission state changes, failing saves, per-blip cooldown expiry and forgetting.
+//
+// Build and run (Linux):
+//   g++ -O2 -std=c++17 tests/BlipTrackerTest.cpp -o blipTrackerTest && ./blipTrackerTest
+//
+// Exits non-zero if any case fails.
+
+#include <cmath>
+#include <cstdio>
+
+#include "../source/ApproachConfig.h"
+
+namespace Config {
+    constexpr unsigned int FRAME_MS = 33;
+    constexpr int MAX_TRACES = 32;
+}
+
+struct Trace {
+    bool inUse = false;
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+// A player and the radar traces around it; the blip at the origin is in use from the start
+class Replay {
+public:
+    Trace traces[Config::MAX_TRACES];
+    float playerX = 0.0f;
+    float playerY = 0.0f;
+    int missionsPassed = 0;
+    unsigned int currentTime = 100000;
+    bool failSaves = false;           // Save calls fail (and are retried) while set
+
+    int saves = 0;
+    unsigned int skipped = 0;         // As Metrics::SlotCounters::skipped for the retry slot
+
+    Replay() {
+        traces[0] = { true, 0.0f, 0.0f };
+    }
+
+    // One frame of AutosaveMod::HandleAutosave, off mission
+    void Frame() {
+        currentTime += Config::FRAME_MS;
+
+        for (const Trace& trace : traces) {
+            if (trace.inUse) m_tracker.Observe(trace.x, trace.y, playerX, playerY, currentTime);
+        }
+        m_tracker.Update(playerX, playerY, currentTime, missionsPassed, true, true, skipped);
+
+        if (m_tracker.HasPending() && !failSaves) {
+            m_tracker.RecordSave(currentTime, missionsPassed);
+            saves++;
+        }
+    }
+
+    void Run(unsigned int durationMs) {
+        for (unsigned int elapsed = 0; elapsed < durationMs; elapsed += Config::FRAME_MS) Frame();
+    }
+
+    // Moves the player to distance x from the blip at the origin and stays for durationMs
+    void StayAt(float x, unsigned int durationMs) {
+        playerX = x;
+        Run(durationMs);
+    }
+
+    bool Pending() const { return m_tracker.HasPending(); }
+    int Tracked() const { return m_tracker.Count(); }
+
+private:
+    BlipTracker::Tracker<Config::MAX_TRACKED_BLIPS> m_tracker{ Config::APPROACH_BLIP_PARAMS };
+};
+
+int g_failures = 0;
+
+void Expect(const char* name, int actual, int expected) {
+    bool ok = actual == expected;
+    printf("%-56s got %d, expected %d: %s\n", name, actual, expected, ok ? "ok" : "FAILED");
+    if (!ok) g_failures++;
+}
+
+// ============================================================================
+// Cases
+// ============================================================================
+
+// Standing on the enter radius with position noise never leaves the exit radius
+void JitterOnEnterRadius() {
+    Replay replay;
+    replay.StayAt(30.0f, 1000);
+    for (int frame = 0; frame < 20000; frame++) {
+        replay.playerX = Config::MISSION_BLIP_DETECTION_RANGE + 0.6f * sinf(frame * 1.7f);
+        replay.Frame();
+    }
+    Expect("jitter across the enter radius (11 min)", replay.saves, 1);
+}
+
+// Two mission givers side by side entered in the same frame: one save, the other reported as skipped
+void TwoBlipsEnteredTogether() {
+    Replay replay;
+    replay.traces[1] = { true, 3.0f, 0.0f };
+    replay.StayAt(30.0f, 1000);
+    replay.StayAt(5.0f, 2000);
+    Expect("two blips entered in one frame", replay.saves, 1);
+    Expect("  ... second entry reported as skipped", (int)replay.skipped, 1);
+}
+
+// A second mission giver reached within the global cooldown is skipped; after it, it saves
+void GlobalCooldownBetweenBlips() {
+    Replay replay;
+    replay.traces[1] = { true, 40.0f, 0.0f };
+    replay.StayAt(5.0f, 2000);
+    replay.StayAt(35.0f, 2000);
+    Expect("second giver 2 s after the first save", replay.saves, 1);
+    Expect("  ... reported as skipped", (int)replay.skipped, 1);
+
+    replay.StayAt(5.0f, Config::AUTOSAVE_COOLDOWN_MS);
+    replay.StayAt(35.0f, 2000);
+    Expect("  ... saves on re-entry after the global cooldown", replay.saves, 2);
+}
+
+// Pacing in and out past the exit radius: re-entries within the cooldown are suppressed
+void PacingThroughExitRadius() {
+    Replay replay;
+    for (int lap = 0; lap < 40; lap++) {
+        replay.StayAt(5.0f, 1500);
+        replay.StayAt(Config::MISSION_BLIP_EXIT_RANGE + 1.0f, 1000);
+    }
+    Expect("pacing in and out every 2.5 s (100 s)", replay.saves, 1);
+    Expect("  ... skipped re-entries reported", replay.skipped > 0, 1);
+}
+
+// The trace drops out for single frames and short stretches while the player stands inside
+void TraceFlicker() {
+    Replay replay;
+    replay.playerX = 5.0f;
+    for (int frame = 0; frame < 10000; frame++) {
+        replay.traces[0].inUse = (frame % 5 != 0) && (frame % 400 >= 40);
+        replay.Frame();
+    }
+    Expect("trace flicker while inside (5.5 min)", replay.saves, 1);
+}
+
+// A failing save stays pending across frames and is not re-triggered by leaving and re-entering
+void FailingSaveRetried() {
+    Replay replay;
+    replay.failSaves = true;
+    replay.StayAt(5.0f, 2000);
+    replay.StayAt(Config::MISSION_BLIP_EXIT_RANGE + 1.0f, 1000);
+    replay.StayAt(5.0f, 1000);
+    Expect("saves failing for 4 s", replay.saves, 0);
+    Expect("  ... still pending", replay.Pending(), 1);
+
+    replay.failSaves = false;
+    replay.Run(1000);
+    Expect("  ... saved once they succeed", replay.saves, 1);
+}
+
+// A new mission state lifts the per-blip gate on the next entry
+void MissionPassedBetweenVisits() {
+    Replay replay;
+    replay.StayAt(5.0f, 2000);
+    replay.StayAt(30.0f, 20000);
+    replay.missionsPassed++;
+    replay.StayAt(5.0f, 2000);
+    Expect("re-entry after a mission was passed", replay.saves, 2);
+}
+
+// Same mission state: a re-entry saves again only after the per-blip cooldown
+void CooldownExpiry() {
+    Replay replay;
+    replay.StayAt(5.0f, 2000);
+    replay.StayAt(Config::MISSION_BLIP_EXIT_RANGE + 1.0f, 30000);
+    replay.StayAt(5.0f, 2000);
+    Expect("re-entry 30 s later, same mission state", replay.saves, 1);
+
+    replay.StayAt(Config::MISSION_BLIP_EXIT_RANGE + 1.0f, Config::PER_BLIP_COOLDOWN_MS);
+    replay.StayAt(5.0f, 2000);
+    Expect("re-entry after the per-blip cooldown", replay.saves, 2);
+}
+
+// Leaving the exit radius stops observations; the saved blip must not be forgotten
+// (and its gate lost) before its cooldown has run out
+void ForgetDuringCooldown() {
+    Replay replay;
+    replay.StayAt(5.0f, 2000);
+    replay.StayAt(Config::MISSION_BLIP_EXIT_RANGE + 1.0f, Config::TRACKED_BLIP_FORGET_MS + 1000);
+    replay.StayAt(5.0f, 2000);
+    Expect("re-entry after the forget timeout, within cooldown", replay.saves, 1);
+
+    replay.StayAt(Config::MISSION_BLIP_EXIT_RANGE + 1.0f, Config::PER_BLIP_COOLDOWN_MS + Config::TRACKED_BLIP_FORGET_MS);
+    Expect("  ... blips tracked once both have run out", replay.Tracked(), 0);
+    replay.StayAt(5.0f, 2000);
+    Expect("  ... and saves again on the next entry", replay.saves, 2);
+}
+
+// Filling the pool with other blips must not evict a blip that holds a cooldown
+void PoolPressureDuringCooldown() {
+    Replay replay;
+    replay.StayAt(5.0f, 2000);
+
+    // Walk past a row of other mission givers, one per 40 units, away from the first blip
+    for (int i = 1; i <= Config::MAX_TRACKED_BLIPS + 4; i++) {
+        replay.traces[i] = { true, 40.0f * i, 100.0f };
+        replay.playerX = 40.0f * i;
+        replay.playerY = 100.0f + Config::MISSION_BLIP_EXIT_RANGE - 1.0f;
+        replay.Run(500);
+    }
+    replay.playerY = 0.0f;
+    replay.StayAt(5.0f, 2000);
+    Expect("re-entry after passing 20 other blips, within cooldown", replay.saves, 1);
+}
+
+int main() {
+    JitterOnEnterRadius();
+    TwoBlipsEnteredTogether();
+    GlobalCooldownBetweenBlips();
+    PacingThroughExitRadius();
+    TraceFlicker();
+    FailingSaveRetried();
+    MissionPassedBetweenVisits();
+    CooldownExpiry();
+    ForgetDuringCooldown();
+    PoolPressureDuringCooldown();
+
+    printf("%s\n", g_failures == 0 ? "all cases passed" : "FAILURES");
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+// ============================================================================
+// FrameAllocTest - replays game frames through AutosaveMod and fails on any heap use
+// ============================================================================
+//
+// Links source/Main.cpp against the plugin-sdk stand-in in tests/sdk and fires
+// the mod's own event handlers for tens of thousands of frames of the scripted
+// session in tests/FrameReplay.h, with CompressAutosaves, PublishMetrics and
+// Debug all enabled.
+//
+// Every frame is a game-process plus a HUD event. Allocations inside them are
+// counted twice: by source/AllocationTracker.cpp (operator new, DEBUG build)
+// and by the malloc/calloc/realloc overrides below, which also catch C-level
+// allocations. The test exits non-zero if either count is not zero, or if the
+// replay did not reach every path it is meant to cover.
+//
+// Build and run (Linux, once per game):
+//   for game in GTA3 GTAVC GTASA; do
+//     g++ -O2 -std=c++17 -DDEBUG -D$game -DTARGET_NAME='"Autosave.FrameAllocTest"' -Itests/sdk source/Main.cpp source/AllocationTracker.cpp tests/GameShim.cpp tests/FrameAllocTest.cpp -o frameAllocTest && ./frameAllocTest || break
+//   done
+// (older glibc: add -lrt)
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "FrameReplay.h"
+#include "../source/AllocationTracker.h"
+#include "../source/Metrics.h"
+
+namespace Config {
+    constexpr int CYCLES = 8;
+    constexpr const char* METRICS_MAPPING_NAME = "Local\\" TARGET_NAME ".Metrics";   // As in source/Main.cpp
+}
+
+// ============================================================================
+// malloc/calloc/realloc counting
+// ============================================================================
+extern "C" {
+    void* __libc_malloc(size_t size);
+    void* __libc_calloc(size_t count, size_t size);
+    void* __libc_realloc(void* ptr, size_t size);
+}
+
+namespace {
+    bool g_inFrame = false;
+    unsigned int g_frameAllocations = 0;
+    size_t g_lastFrameAllocationSize = 0;
+
+    void CountAllocation(size_t size) {
+        if (!g_inFrame) return;
+        g_frameAllocations++;
+        g_lastFrameAllocationSize = size;
+    }
+
+    // FrameReplay hooks: count only what the frame's event handlers allocate
+    void StartCounting() { g_inFrame = true; }
+    void StopCounting() { g_inFrame = false; }
+}
+
+extern "C" void* malloc(size_t size) {
+    CountAllocation(size);
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+    CountAllocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+    CountAllocation(size);
+    return __libc_realloc(ptr, size);
+}
+
+// ============================================================================
+// Checks
+// ============================================================================
+int g_failures = 0;
+
+void Expect(const char* name, bool ok, int value) {
+    printf("%-44s %d: %s\n", name, value, ok ? "ok" : "FAILED");
+    if (!ok) g_failures++;
+}
+
+// Confirms both counters see an allocation made where a frame would make it
+unsigned int SelfCheck() {
+    unsigned int violationsBefore = AllocationTracker::Violations();
+    g_inFrame = true;
+    {
+        AllocationTracker::NoAllocScope noAlloc;
+        void* object = ::operator new(64);
+        ::operator delete(object);
+        void* volatile block = malloc(64);
+        free(block);
+    }
+    g_inFrame = false;
+
+    unsigned int seen = g_frameAllocations;
+    Expect("self-check: operator new seen by tracker", AllocationTracker::Violations() - violationsBefore == 1,
+           AllocationTracker::Violations() - violationsBefore);
+    Expect("self-check: new + malloc seen by override", seen == 2, seen);
+    g_frameAllocations = 0;
+    return AllocationTracker::Violations();
+}
+
+int main() {
+    char documents[] = "/tmp/frameAllocTest.XXXXXX";
+    if (!mkdtemp(documents)) {
+        perror("mkdtemp");
+        return 1;
+    }
+
+    unsigned int violationsBefore = SelfCheck();
+
+    GameShim::Init(documents);
+    GameShim::SetConfig("Debug", 1);
+    GameShim::SetConfig("CompressAutosaves", 1);
+    GameShim::SetConfig("PublishMetrics", 1);
+    FrameReplay::PlaceBlips();
+    FrameReplay::onFrameStart = StartCounting;
+    FrameReplay::onFrameEnd = StopCounting;
+
+    plugin::Events::initGameEvent();
+    for (int cycle = 0; cycle < Config::CYCLES; cycle++) {
+        FrameReplay::Cycle(cycle);
+    }
+
+    // Read back what the mod published
+    Metrics::Mapping reader;
+    Metrics::Data metrics = {};
+    bool published = reader.Open(Config::METRICS_MAPPING_NAME) && Metrics::Read(*reader.Get(), metrics);
+
+    int retrySlot = 7, completeSlot = 6;
+    printf("%s: %d frames\n", TARGET_NAME, FrameReplay::frames);
+    Expect("event handlers registered once", plugin::Events::gameProcessEvent.HandlerCount() == 1,
+           plugin::Events::gameProcessEvent.HandlerCount());
+    int failedCalls = GameShim::saveCalls[retrySlot] - GameShim::savesWritten[retrySlot];
+#ifdef GTAVC
+    // The mod treats every VC save call as a success, so a failing save is not retried
+    Expect("approach saves written", GameShim::savesWritten[retrySlot] == Config::CYCLES / 2, GameShim::savesWritten[retrySlot]);
+    Expect("failed approach save calls", failedCalls == Config::CYCLES / 2, failedCalls);
+#else
+    Expect("approach saves written", GameShim::savesWritten[retrySlot] == Config::CYCLES, GameShim::savesWritten[retrySlot]);
+    Expect("failed approach save calls (retried)", failedCalls > Config::CYCLES / 2, failedCalls);
+#endif
+    Expect("mission complete saves written", GameShim::savesWritten[completeSlot] == Config::CYCLES / 3, GameShim::savesWritten[completeSlot]);
+#ifdef GTASA
+    bool completeSlotNative = CGenericGameStorage::CheckSlotDataValid(completeSlot, false);
+#else
+    bool completeSlotNative = CheckSlotDataValid(completeSlot);
+#endif
+    Expect("mission complete slot left native", completeSlotNative, completeSlotNative);
+    Expect("retry loads", FrameReplay::loads > 0, FrameReplay::loads);
+    Expect("metrics published", published, published);
+    Expect("metrics: frames", metrics.frameCount == (uint64_t)FrameReplay::frames, (unsigned int)metrics.frameCount);
+    Expect("metrics: retry prompts shown", metrics.retryPromptsShown == (unsigned int)FrameReplay::missionsFailed,
+           metrics.retryPromptsShown);
+    Expect("metrics: retry prompts accepted", metrics.retryPromptsAccepted == (unsigned int)FrameReplay::loads,
+           metrics.retryPromptsAccepted);
+    Expect("metrics: games loaded (start + retries)", metrics.gamesLoaded == 1u + FrameReplay::loads, metrics.gamesLoaded);
+    Expect("metrics: slot packs", metrics.pack.succeeded > 0 && metrics.pack.failed == 0, metrics.pack.succeeded);
+    Expect("metrics: slot unpacks", metrics.unpack.succeeded > 0 && metrics.unpack.failed == 0, metrics.unpack.succeeded);
+    // A save plus its container fit in the arena reserved at init
+    Expect("metrics: slot arena high water",
+           metrics.slotArenaHighWater >= metrics.pack.lastRawSize + metrics.pack.lastPackedSize &&
+           metrics.slotArenaHighWater <= metrics.slotArenaCapacity, metrics.slotArenaHighWater);
+
+    unsigned int trackerAllocations = AllocationTracker::Violations() - violationsBefore;
+    Expect("operator new calls inside frames", trackerAllocations == 0, trackerAllocations);
+    Expect("malloc/calloc/realloc calls inside frames", g_frameAllocations == 0, g_frameAllocations);
+    if (g_frameAllocations > 0) {
+        printf("  last allocation: %zu bytes\n", g_lastFrameAllocationSize);
+    }
+
+    FrameReplay::RemoveDirectory(documents);
+    printf("%s\n", g_failures == 0 ? "all checks passed" : "FAILURES");
+    return g_failures == 0 ? 0 : 1;
+}
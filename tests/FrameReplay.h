@@ -0,0 +1,137 @@
+#pragma once
+// ============================================================================
+// FrameReplay - scripted game frames fired through AutosaveMod's event handlers
+// ============================================================================
+//
+// Drives source/Main.cpp, linked against the plugin-sdk stand-in in tests/sdk,
+// through approach saves (some failing and retried), mission failures with
+// the retry prompt accepted or declined, retry loads through the game's
+// restart event, and mission complete saves. Used by tests/FrameAllocTest.cpp
+// and tests/MetricsSimulator.cpp.
+
+#include <cstdio>
+#include <dirent.h>
+#include <unistd.h>
+
+#include "sdk/GameShim.h"
+
+namespace FrameReplay {
+
+    namespace Config {
+        constexpr unsigned int FRAME_MS = 33;
+        constexpr float BLIP_X = 0.0f;
+        constexpr float BLIP_Y = 0.0f;
+        constexpr float FAR_AWAY = 60.0f;
+        constexpr float AT_BLIP = 5.0f;
+        constexpr unsigned int START_TIME_MS = 100000;
+        constexpr unsigned int LOAD_REWINDS_TIMER_MS = 60000;   // Loaded saves carry an older game timer
+    }
+
+    // Called right before and after the frame's event handlers run
+    inline void (*onFrameStart)() = nullptr;
+    inline void (*onFrameEnd)() = nullptr;
+
+    inline int frames = 0;
+    inline int loads = 0;
+    inline int missionsFailed = 0;
+
+    // A mission giver at the origin with a save house next to it
+    inline void PlaceBlips() {
+        CRadar::ms_RadarTrace[3] = { true, GameShim::MissionGiverSprite(), { Config::BLIP_X, Config::BLIP_Y, 0.0f } };
+        CRadar::ms_RadarTrace[4] = { true, RADAR_SPRITE_SAVEHOUSE, { Config::BLIP_X + 3.0f, Config::BLIP_Y, 0.0f } };
+        CTimer::m_snTimeInMilliseconds = Config::START_TIME_MS;
+    }
+
+    inline void SetPlayer(float x) {
+        CPlayerPed* player = CWorld::Players[0].m_pPed;
+        player->m_vecPosition = { Config::BLIP_X + x, Config::BLIP_Y, 0.0f };
+    }
+
+    // One game frame: process and HUD events, then a load if the mod requested one
+    inline void Frame() {
+        CTimer::m_snTimeInMilliseconds += Config::FRAME_MS;
+        frames++;
+
+        if (onFrameStart) onFrameStart();
+        plugin::Events::gameProcessEvent();
+        plugin::Events::drawHudEvent();
+        if (onFrameEnd) onFrameEnd();
+
+        if (GameShim::ConsumeLoadRequest()) {
+            loads++;
+            CTimer::m_snTimeInMilliseconds -= Config::LOAD_REWINDS_TIMER_MS;
+            CMessages::BIGMessages[0].m_Current = {};
+            GameShim::SetOnMission(false);
+            plugin::Events::reInitGameEvent();
+        }
+    }
+
+    inline void Run(unsigned int durationMs) {
+        for (unsigned int elapsed = 0; elapsed < durationMs; elapsed += Config::FRAME_MS) Frame();
+    }
+
+    inline void WalkTo(float x, unsigned int durationMs) {
+        float from = CWorld::Players[0].m_pPed->GetPosition().x - Config::BLIP_X;
+        unsigned int steps = durationMs / Config::FRAME_MS;
+        for (unsigned int step = 1; step <= steps; step++) {
+            SetPlayer(from + (x - from) * (float)step / (float)steps);
+            Frame();
+        }
+    }
+
+    inline void PressKey(unsigned int key) {
+        GameShim::SetKey(key, true);
+        Run(100);
+        GameShim::SetKey(key, false);
+        Run(100);
+    }
+
+    // Approach, start the mission, then fail it (prompt accepted or declined) or pass it
+    inline void Cycle(int cycle) {
+        SetPlayer(Config::FAR_AWAY);
+        Run(2000);
+
+        // Odd cycles: the approach save fails for a second and is retried every frame
+        GameShim::saveFails = (cycle % 2) == 1;
+        WalkTo(Config::AT_BLIP, 4000);
+        Run(1000);
+        GameShim::saveFails = false;
+        Run(2000);
+
+        GameShim::SetOnMission(true);
+        Run(10000);
+
+        if (cycle % 3 != 2) {
+            missionsFailed++;
+            GameShim::SetOnMission(false);
+            GameShim::ShowMissionFailedText(5000);
+            Run(1000);
+            PressKey((cycle % 3 == 0) ? 'Y' : 'N');
+            Run(2000);
+        } else {
+            CStats::MissionsPassed++;
+            GameShim::SetOnMission(false);
+            Run(3000);
+        }
+
+        WalkTo(Config::FAR_AWAY, 3000);
+
+        // Long enough for the global and per-blip cooldowns to run out
+        Run(130000);
+    }
+
+    // Removes the temporary documents folder and the slot files in it
+    inline void RemoveDirectory(const char* path) {
+        DIR* dir = opendir(path);
+        if (!dir) return;
+        char file[MAX_PATH * 2];
+        while (dirent* entry = readdir(dir)) {
+            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+            snprintf(file, sizeof(file), "%s/%s", path, entry->d_name);
+            unlink(file);
+        }
+        closedir(dir);
+        rmdir(path);
+    }
+
+} // namespace FrameReplay
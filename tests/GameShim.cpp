@@ -0,0 +1,242 @@
+// ============================================================================
+// GameShim - behaviour behind tests/sdk/GameShim.h
+// ============================================================================
+//
+// Everything here may run inside the mod's frame handlers, so none of it
+// allocates: file APIs go straight to POSIX calls and saves are written from
+// a static buffer.
+
+#include "sdk/GameShim.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+    constexpr size_t SAVE_SIZE = 200000;   // Close to a III slot file
+
+    char g_documents[MAX_PATH] = ".";
+    CPlayerPed g_player;
+    bool g_keys[256];
+    int g_saveSlot = 0;                    // SA: slot chosen by MakeValidSaveName
+    unsigned int g_saveCount = 0;
+    uint8_t g_saveBuffer[SAVE_SIZE];
+
+    struct ConfigEntry {
+        char key[32];
+        plugin::config_value value;
+    };
+    ConfigEntry g_config[16];
+
+    int ToFd(HANDLE file) { return (int)(intptr_t)file; }
+
+    // Same location as SlotStorage::GetSlotFilePath in source/Main.cpp
+    void GetSlotPath(int slot, char* out, size_t outSize) {
+#ifdef GTA3
+        snprintf(out, outSize, "%s\\GTA3 User Files\\GTA3sf%d.b", g_documents, slot + 1);
+#elif defined(GTAVC)
+        snprintf(out, outSize, "%s\\GTA Vice City User Files\\GTAVCsf%d.b", g_documents, slot + 1);
+#elif defined(GTASA)
+        snprintf(out, outSize, "%s\\GTA San Andreas User Files\\GTASAsf%d.b", g_documents, slot + 1);
+#endif
+    }
+
+    // Mostly repetitive data with a changing stretch, like a real save
+    bool WriteSave(int slot) {
+        if (slot < 0 || slot >= 8) return false;
+        GameShim::saveCalls[slot]++;
+        if (GameShim::saveFails) return false;
+
+        g_saveCount++;
+        for (size_t i = 0; i < SAVE_SIZE; i++) {
+            g_saveBuffer[i] = (i % 4096) < 1024 ? (uint8_t)(i * 7 + g_saveCount) : (uint8_t)(i / 4096);
+        }
+
+        char path[MAX_PATH + 64];
+        GetSlotPath(slot, path, sizeof(path));
+        int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return false;
+        bool ok = write(fd, g_saveBuffer, SAVE_SIZE) == (ssize_t)SAVE_SIZE;
+        ok = close(fd) == 0 && ok;
+        if (ok) GameShim::savesWritten[slot]++;
+        return ok;
+    }
+
+    bool SlotFileExists(int slot) {
+        char path[MAX_PATH + 64];
+        GetSlotPath(slot, path, sizeof(path));
+        struct stat st;
+        return stat(path, &st) == 0 && st.st_size > 0;
+    }
+
+} // namespace
+
+// ============================================================================
+// Win32
+// ============================================================================
+HRESULT SHGetFolderPathA(void*, int, void*, DWORD, char* path) {
+    snprintf(path, MAX_PATH, "%s", g_documents);
+    return 0;
+}
+
+HANDLE CreateFileA(const char* path, DWORD access, DWORD, void*, DWORD disposition, DWORD, void*) {
+    int flags = (access & GENERIC_WRITE) ? O_WRONLY : O_RDONLY;
+    if (disposition == CREATE_ALWAYS) flags |= O_CREAT | O_TRUNC;
+    int fd = open(path, flags, 0644);
+    return fd < 0 ? INVALID_HANDLE_VALUE : (HANDLE)(intptr_t)fd;
+}
+
+bool GetFileSizeEx(HANDLE file, LARGE_INTEGER* size) {
+    struct stat st;
+    if (fstat(ToFd(file), &st) != 0) return false;
+    size->QuadPart = st.st_size;
+    return true;
+}
+
+bool ReadFile(HANDLE file, void* buffer, DWORD size, DWORD* bytesRead, void*) {
+    ssize_t n = read(ToFd(file), buffer, size);
+    *bytesRead = n > 0 ? (DWORD)n : 0;
+    return n >= 0;
+}
+
+bool WriteFile(HANDLE file, const void* buffer, DWORD size, DWORD* bytesWritten, void*) {
+    ssize_t n = write(ToFd(file), buffer, size);
+    *bytesWritten = n > 0 ? (DWORD)n : 0;
+    return n >= 0;
+}
+
+bool CloseHandle(HANDLE file) {
+    return close(ToFd(file)) == 0;
+}
+
+bool DeleteFileA(const char* path) {
+    return unlink(path) == 0;
+}
+
+bool MoveFileExA(const char* from, const char* to, DWORD) {
+    return rename(from, to) == 0;
+}
+
+// Write time in 100 ns units, like FILETIME
+bool GetFileAttributesExA(const char* path, GET_FILEEX_INFO_LEVELS, WIN32_FILE_ATTRIBUTE_DATA* info) {
+    struct stat st;
+    if (stat(path, &st) != 0) return false;
+    uint64_t time = (uint64_t)st.st_mtim.tv_sec * 10000000ull + (uint64_t)st.st_mtim.tv_nsec / 100;
+    info->ftLastWriteTime.dwLowDateTime = (DWORD)time;
+    info->ftLastWriteTime.dwHighDateTime = (DWORD)(time >> 32);
+    return true;
+}
+
+// ============================================================================
+// Game
+// ============================================================================
+bool C_PcSave::SaveSlot(int slot) {
+    return WriteSave(slot);
+}
+
+void MakeValidSaveName(int slot) {
+    g_saveSlot = slot;
+}
+
+bool CheckSlotDataValid(int slot) {
+    return SlotFileExists(slot);
+}
+
+void CGenericGameStorage::MakeValidSaveName(int slot) {
+    g_saveSlot = slot;
+}
+
+bool CGenericGameStorage::GenericSave(int) {
+    return WriteSave(g_saveSlot);
+}
+
+bool CGenericGameStorage::CheckSlotDataValid(int slot, bool) {
+    return SlotFileExists(slot);
+}
+
+bool plugin::KeyPressed(unsigned int key) {
+    return key < 256 && g_keys[key];
+}
+
+plugin::config_value& plugin::config_file::operator[](const char* key) {
+    for (ConfigEntry& entry : g_config) {
+        if (strcmp(entry.key, key) == 0) return entry.value;
+        if (entry.key[0] == '\0') {
+            snprintf(entry.key, sizeof(entry.key), "%s", key);
+            return entry.value;
+        }
+    }
+    static config_value overflow;
+    return overflow;
+}
+
+// ============================================================================
+// Test controls
+// ============================================================================
+namespace GameShim {
+
+    bool saveFails = false;
+    int saveCalls[8];
+    int savesWritten[8];
+
+    void Init(const char* documentsDir) {
+        // The mod appends "\<game> User Files\..."; on Linux that is one file name inside documentsDir
+        snprintf(g_documents, sizeof(g_documents), "%s/", documentsDir);
+        CWorld::Players[0].m_pPed = &g_player;
+    }
+
+    int MissionGiverSprite() {
+#ifdef GTA3
+        return RADAR_SPRITE_LUIGI;
+#elif defined(GTAVC)
+        return RADAR_SPRITE_AVERY;
+#elif defined(GTASA)
+        return RADAR_SPRITE_SWEET;
+#endif
+    }
+
+    void SetOnMission(bool onMission) {
+#ifdef GTA3
+        int flag = onMission ? 1 : 0;
+        CTheScripts::OnAMissionFlag = 16;
+        memcpy(&CTheScripts::ScriptSpace[CTheScripts::OnAMissionFlag], &flag, sizeof(flag));
+#else
+        CTheScripts::onMission = onMission;
+#endif
+    }
+
+    void ShowMissionFailedText(unsigned int durationMs) {
+        tMessage& message = CMessages::BIGMessages[0].m_Current;
+#ifdef GTA3
+        message.m_pText = L"MISSION FAILED!";
+        message.m_nTime = durationMs;
+        message.m_nStartTime = CTimer::m_snTimeInMilliseconds;
+#elif defined(GTASA)
+        message.m_pText = "MISSION FAILED!";
+        message.m_dwTime = durationMs;
+        message.m_dwStartTime = CTimer::m_snTimeInMilliseconds;
+#else
+        (void)message;
+        (void)durationMs;
+#endif
+    }
+
+    void SetKey(unsigned int key, bool down) {
+        if (key < 256) g_keys[key] = down;
+    }
+
+    void SetConfig(const char* key, int value) {
+        plugin::config_file config(true, false);
+        config[key] = value;
+    }
+
+    bool ConsumeLoadRequest() {
+        if (!FrontEndMenuManager.m_bWantToLoad) return false;
+        FrontEndMenuManager.m_bWantToLoad = false;
+        FrontEndMenuManager.m_bWantToRestart = false;
+        b_FoundRecentSavedGameWantToLoad = false;
+        return true;
+    }
+
+} // namespace GameShim
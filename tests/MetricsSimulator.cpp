@@ -0,0 +1,73 @@
+// ============================================================================
+// MetricsSimulator - runs AutosaveMod on Linux so MetricsReader has a block to read
+// ============================================================================
+//
+// Links source/Main.cpp against the plugin-sdk stand-in in tests/sdk and
+// replays the scripted session of tests/FrameReplay.h in real time, over and
+// over, with PublishMetrics and CompressAutosaves enabled. Every counter in
+// the block comes from the mod itself: the same save calls, retry prompts,
+// loads, slot packs and phase timings it publishes in the game. Run it in one
+// terminal and tools/MetricsReader in another to exercise dashboards and
+// collectors.
+//
+// TARGET_NAME sets the mapping name, so build it as the game's plugin name:
+//   g++ -O2 -std=c++17 -DGTA3 -DTARGET_NAME='"Autosave.III"' -Itests/sdk source/Main.cpp source/AllocationTracker.cpp tests/GameShim.cpp tests/MetricsSimulator.cpp -o metricssimulator
+// (or -DGTAVC with "Autosave.VC", -DGTASA with "Autosave.SA"; older glibc: add -lrt)
+//
+// Usage:
+//   metricssimulator [-x speed]
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "FrameReplay.h"
+
+namespace {
+    volatile std::sig_atomic_t g_stopRequested = 0;
+    char g_documents[] = "/tmp/metricsSimulator.XXXXXX";
+    std::chrono::microseconds g_frameDuration{ FrameReplay::Config::FRAME_MS * 1000 };
+
+    // FrameReplay hook: paces frames at game speed and stops between frames
+    void EndFrame() {
+        std::this_thread::sleep_for(g_frameDuration);
+        if (g_stopRequested) {
+            FrameReplay::RemoveDirectory(g_documents);
+            exit(0);   // Runs the mod's destructor, which removes the mapping
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-x") == 0 && i + 1 < argc) {
+            double speed = atof(argv[++i]);
+            if (speed > 0.0) g_frameDuration = std::chrono::microseconds((long long)(g_frameDuration.count() / speed));
+        } else {
+            fprintf(stderr, "usage: metricssimulator [-x speed]\n");
+            return 2;
+        }
+    }
+
+    if (!mkdtemp(g_documents)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    std::signal(SIGINT, [](int) { g_stopRequested = 1; });
+    std::signal(SIGTERM, [](int) { g_stopRequested = 1; });
+
+    GameShim::Init(g_documents);
+    GameShim::SetConfig("CompressAutosaves", 1);
+    GameShim::SetConfig("PublishMetrics", 1);
+    FrameReplay::PlaceBlips();
+    FrameReplay::onFrameEnd = EndFrame;
+
+    plugin::Events::initGameEvent();
+    printf("%s publishing metrics (Ctrl+C to stop)\n", TARGET_NAME);
+    fflush(stdout);
+    for (int cycle = 0; ; cycle++) {
+        FrameReplay::Cycle(cycle);
+    }
+}
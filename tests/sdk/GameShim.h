@@ -0,0 +1,363 @@
+#pragma once
+// ============================================================================
+// GameShim - host stand-in for the plugin-sdk and Win32 parts of the mod
+// ============================================================================
+//
+// Declares just enough of the plugin-sdk game classes, events and Win32 APIs
+// for source/Main.cpp to compile and run on Linux. The per-header files in
+// this folder (plugin.h, CTimer.h, shlobj.h, ...) all forward here. Game state
+// lives in plain statics the test sets directly or through namespace GameShim;
+// file APIs map onto POSIX calls that never touch the heap.
+//
+// Build with exactly one of GTA3, GTAVC or GTASA defined, like the mod.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+
+#define sprintf_s snprintf
+
+// ============================================================================
+// Win32 (shlobj.h and friends)
+// ============================================================================
+#define MAX_PATH 260
+#define CSIDL_PERSONAL 5
+#define FAILED(hr) ((hr) < 0)
+#define MOVEFILE_REPLACE_EXISTING 1
+#define GENERIC_READ 0x80000000u
+#define GENERIC_WRITE 0x40000000u
+#define FILE_SHARE_READ 1
+#define CREATE_ALWAYS 2
+#define OPEN_EXISTING 3
+#define FILE_ATTRIBUTE_NORMAL 0x80
+
+typedef void* HANDLE;
+typedef unsigned long DWORD;
+typedef long HRESULT;
+#define INVALID_HANDLE_VALUE ((HANDLE)(intptr_t)-1)
+
+struct FILETIME {
+    DWORD dwLowDateTime;
+    DWORD dwHighDateTime;
+};
+
+struct WIN32_FILE_ATTRIBUTE_DATA {
+    FILETIME ftLastWriteTime;
+};
+
+enum GET_FILEEX_INFO_LEVELS { GetFileExInfoStandard };
+
+union LARGE_INTEGER {
+    long long QuadPart;
+};
+
+HRESULT SHGetFolderPathA(void* owner, int folder, void* token, DWORD flags, char* path);
+HANDLE CreateFileA(const char* path, DWORD access, DWORD share, void* security, DWORD disposition, DWORD flags, void* templateFile);
+bool GetFileSizeEx(HANDLE file, LARGE_INTEGER* size);
+bool ReadFile(HANDLE file, void* buffer, DWORD size, DWORD* bytesRead, void* overlapped);
+bool WriteFile(HANDLE file, const void* buffer, DWORD size, DWORD* bytesWritten, void* overlapped);
+bool CloseHandle(HANDLE file);
+bool DeleteFileA(const char* path);
+bool MoveFileExA(const char* from, const char* to, DWORD flags);
+bool GetFileAttributesExA(const char* path, GET_FILEEX_INFO_LEVELS level, WIN32_FILE_ATTRIBUTE_DATA* info);
+
+// ============================================================================
+// Game classes
+// ============================================================================
+struct CVector {
+    float x, y, z;
+};
+
+struct CRGBA {
+    unsigned char r, g, b, a;
+    CRGBA(int red, int green, int blue, int alpha)
+        : r((unsigned char)red), g((unsigned char)green), b((unsigned char)blue), a((unsigned char)alpha) {}
+};
+
+enum ePedState {
+    PEDSTATE_IDLE,
+    PEDSTATE_DEAD,
+    PEDSTATE_DIE,
+    PEDSTATE_ARRESTED,
+    PEDSTATE_ENTER_CAR,
+    PEDSTATE_EXIT_CAR,
+    PEDSTATE_CARJACK,
+    PEDSTATE_CAR_JACK,
+    PEDSTATE_DRIVING,
+    PEDSTATE_PASSENGER
+};
+
+struct CVehicle {};
+
+struct CPlayerPed {
+    ePedState m_ePedState = PEDSTATE_IDLE;
+    CVehicle* m_pVehicle = nullptr;
+    bool bInVehicle = false;              // SA
+    bool m_bInVehicle = false;            // III, VC
+    float m_fCurrentRotation = 0.0f;      // SA
+    float m_fAimingRotation = 0.0f;
+    float m_fRotationCur = 0.0f;          // III, VC
+    float m_fRotationDest = 0.0f;
+    CVector m_vecPosition = {};           // Shim only: what GetPosition() returns
+
+    CVector GetPosition() const { return m_vecPosition; }
+};
+
+struct CPlayerInfo {
+    CPlayerPed* m_pPed;
+};
+
+struct CWorld {
+    static inline CPlayerInfo Players[1];
+};
+
+struct CTimer {
+    static inline unsigned int m_snTimeInMilliseconds = 0;
+};
+
+struct CClock {
+    static inline unsigned char ms_nGameClockHours = 0;
+    static inline unsigned char ms_nGameClockMinutes = 0;
+    static inline unsigned short ms_nGameClockSeconds = 0;
+};
+
+struct CCutsceneMgr {
+    static inline bool ms_running = false;
+};
+
+struct CTheScripts {
+    static inline int OnAMissionFlag = 0;                 // III: offset of the mission flag in ScriptSpace
+    static inline unsigned char ScriptSpace[256];
+    static inline bool onMission = false;                 // Shim only: VC/SA IsPlayerOnAMission()
+    static bool IsPlayerOnAMission() { return onMission; }
+};
+
+struct CStats {
+    static inline int MissionsPassed = 0;
+    static float GetStatValue(int) { return (float)MissionsPassed; }   // SA: only STAT_MISSIONS_PASSED is read
+};
+
+enum eStats { STAT_MISSIONS_PASSED = 147 };
+
+struct tRadarTrace {
+    bool m_bInUse;
+    int m_nRadarSprite;
+    CVector m_vecPos;
+};
+
+constexpr unsigned int MAX_RADAR_TRACES = 175;
+
+struct CRadar {
+    static inline tRadarTrace ms_RadarTrace[MAX_RADAR_TRACES];
+};
+
+enum eRadarSprite {
+    RADAR_SPRITE_NONE,
+    // III
+    RADAR_SPRITE_ASUKA, RADAR_SPRITE_CAT, RADAR_SPRITE_DON, RADAR_SPRITE_EIGHT, RADAR_SPRITE_EL,
+    RADAR_SPRITE_ICE, RADAR_SPRITE_JOEY, RADAR_SPRITE_KENJI, RADAR_SPRITE_LIZ, RADAR_SPRITE_LUIGI,
+    RADAR_SPRITE_RAY, RADAR_SPRITE_SAL, RADAR_SPRITE_TONY,
+    // VC
+    RADAR_SPRITE_AVERY, RADAR_SPRITE_BIKER, RADAR_SPRITE_CORTEZ, RADAR_SPRITE_DIAZ, RADAR_SPRITE_KENT,
+    RADAR_SPRITE_LAWYER, RADAR_SPRITE_PHIL, RADAR_SPRITE_BOATYARD, RADAR_SPRITE_MALIBU_CLUB,
+    RADAR_SPRITE_FILM, RADAR_SPRITE_PRINTWORKS, RADAR_SPRITE_CUBANS, RADAR_SPRITE_HAITIANS,
+    RADAR_SPRITE_BIKERS, RADAR_SPRITE_LOVEFIST, RADAR_SPRITE_SUNYARD,
+    // SA
+    RADAR_SPRITE_BIGSMOKE, RADAR_SPRITE_CATALINAPINK, RADAR_SPRITE_CESARVIAPANDO, RADAR_SPRITE_CJ,
+    RADAR_SPRITE_CRASH1, RADAR_SPRITE_LOGOSYNDICATE, RADAR_SPRITE_MADDOG, RADAR_SPRITE_MAFIACASINO,
+    RADAR_SPRITE_MCSTRAP, RADAR_SPRITE_OGLOC, RADAR_SPRITE_RYDER, RADAR_SPRITE_QMARK, RADAR_SPRITE_SWEET,
+    RADAR_SPRITE_THETRUTH, RADAR_SPRITE_TORENORANCH, RADAR_SPRITE_TRIADS, RADAR_SPRITE_TRIADSCASINO,
+    RADAR_SPRITE_WOOZIE, RADAR_SPRITE_ZERO,
+    // Not a mission giver
+    RADAR_SPRITE_SAVEHOUSE
+};
+
+struct CCam {
+    float m_fHorizontalAngle;
+    float m_fTargetBeta;
+    float m_fTrueBeta;
+    float m_fTransitionBeta;
+};
+
+struct CCamera {
+    int m_nActiveCam;
+    CCam m_aCams[3];      // SA
+    CCam m_asCams[3];     // III, VC
+};
+
+inline CCamera TheCamera;
+
+#ifdef GTASA
+struct tMessage {
+    const char* m_pText;
+    unsigned int m_dwTime;
+    unsigned int m_dwStartTime;
+};
+#else
+struct tMessage {
+    const wchar_t* m_pText;
+    unsigned int m_nTime;
+    unsigned int m_nStartTime;
+};
+#endif
+
+struct tBigMessage {
+    tMessage m_Current;
+};
+
+enum class eMessageStyle { STYLE_COUNT = 7 };
+
+struct CMessages {
+    static inline tBigMessage BIGMessages[7];
+    static void AddMessage(const char*, unsigned int, unsigned short) {}
+};
+
+enum { ALIGN_LEFT, ALIGN_CENTER, FONT_GOTHIC, FONT_HEADING };
+
+struct CFont {
+    static void SetOrientation(int) {}
+    static void SetBackground(bool, bool) {}
+    static void SetBackgroundOff() {}
+    static void SetScale(float, float) {}
+    static void SetFontStyle(int) {}
+    static void SetProportional(bool) {}
+    static void SetPropOn() {}
+    static void SetWrapx(float) {}
+    static void SetColor(CRGBA) {}
+    static void SetDropShadowPosition(int) {}
+    static void SetDropColor(CRGBA) {}
+    static void SetJustifyOff() {}
+    static void SetRightJustifyOff() {}
+    static void SetCentreOn() {}
+    static void SetCentreOff() {}
+    static void SetCentreSize(float) {}
+    static void PrintString(float, float, const char*) {}
+    static void PrintString(float, float, const wchar_t*) {}
+};
+
+inline void AsciiToUnicode(const char* src, wchar_t* dst) {
+    while ((*dst++ = (unsigned char)*src++) != 0) {}
+}
+
+struct CMenuManager {
+    int m_nCurrentSaveSlot;
+    int m_nSelectedSaveGame;
+    bool m_bWantToLoad;
+    bool m_bWantToRestart;
+};
+
+inline CMenuManager FrontEndMenuManager;
+inline bool b_FoundRecentSavedGameWantToLoad = false;
+
+// Saving: writes a synthetic slot file where the game would
+struct C_PcSave {
+    bool SaveSlot(int slot);
+};
+
+inline C_PcSave PcSaveHelper;
+
+void MakeValidSaveName(int slot);
+bool CheckSlotDataValid(int slot);
+
+struct CGenericGameStorage {
+    static void MakeValidSaveName(int slot);
+    static bool GenericSave(int);
+    static bool CheckSlotDataValid(int slot, bool);
+};
+
+// ============================================================================
+// plugin-sdk
+// ============================================================================
+namespace plugin {
+
+    // Fixed handler list: constant-initialized, so handlers registered by the
+    // mod's global instance are never lost to static initialization order
+    class Event {
+    public:
+        void operator+=(void (*handler)()) {
+            if (m_count < MAX_HANDLERS) m_handlers[m_count++] = handler;
+        }
+
+        void operator()() const {
+            for (int i = 0; i < m_count; i++) m_handlers[i]();
+        }
+
+        int HandlerCount() const { return m_count; }
+
+    private:
+        static constexpr int MAX_HANDLERS = 8;
+        void (*m_handlers[MAX_HANDLERS])();
+        int m_count;
+    };
+
+    struct Events {
+        static inline Event initGameEvent;
+        static inline Event reInitGameEvent;
+        static inline Event gameProcessEvent;
+        static inline Event drawHudEvent;
+    };
+
+    bool KeyPressed(unsigned int key);
+
+    class config_value {
+    public:
+        int asInt(int defaultValue) const { return m_set ? m_value : defaultValue; }
+        bool isEmpty() const { return !m_set; }
+        config_value& operator=(int value) {
+            m_value = value;
+            m_set = true;
+            return *this;
+        }
+
+    private:
+        int m_value = 0;
+        bool m_set = false;
+    };
+
+    // Reads the settings set with GameShim::SetConfig instead of an ini file
+    class config_file {
+    public:
+        config_file(bool, bool) {}
+        config_value& operator[](const char* key);
+        void save() {}
+    };
+
+} // namespace plugin
+
+// extensions/Screen.h
+#define SCREEN_COORD(a) (a)
+#define SCREEN_COORD_LEFT(a) (a)
+#define SCREEN_COORD_TOP(a) (a)
+#define SCREEN_COORD_BOTTOM(a) (480.0f - (a))
+#define SCREEN_COORD_CENTER_X 320.0f
+
+// ============================================================================
+// Test controls
+// ============================================================================
+namespace GameShim {
+
+    // Sets up the player and points the Documents folder at documentsDir
+    void Init(const char* documentsDir);
+
+    // Mission giver sprite for the game being built
+    int MissionGiverSprite();
+
+    void SetOnMission(bool onMission);
+
+    // III/SA: puts "MISSION FAILED" in a big message slot for durationMs
+    void ShowMissionFailedText(unsigned int durationMs);
+
+    void SetKey(unsigned int key, bool down);
+    void SetConfig(const char* key, int value);
+
+    // Returns true once per load the mod requested through the front end menu
+    bool ConsumeLoadRequest();
+
+    extern bool saveFails;                // Save calls report failure (III/SA) and write nothing
+    extern int saveCalls[8];              // Per slot
+    extern int savesWritten[8];
+
+} // namespace GameShim
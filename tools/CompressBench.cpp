@@ -0,0 +1,163 @@
+// ============================================================================
+// CompressBench - throughput and ratio of the autosave slot container
+// ============================================================================
+//
+// Runs source/SaveCompression.h over save-sized payloads and reports the
+// compression ratio and compress/decompress time per save, verifying every
+// round trip byte for byte.
+//
+// Build (Linux):
+//   g++ -O2 -std=c++17 tools/CompressBench.cpp -o compressbench
+//
+// Usage:
+//   compressbench [-n iterations] [save files...]
+//
+// Without files it uses synthetic payloads at the slot file sizes of the three
+// games: mostly zeroed pool slots, repeated fixed-layout records with a few
+// changing fields, and a share of high-entropy bytes (script space, RNG state).
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../source/SaveCompression.h"
+
+namespace Config {
+    constexpr int DEFAULT_ITERATIONS = 200;
+}
+
+struct Payload {
+    std::string name;
+    std::vector<uint8_t> data;
+};
+
+namespace Synthetic {
+
+    uint32_t NextRandom(uint32_t& state) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    std::vector<uint8_t> MakeSave(size_t size, uint32_t seed) {
+        std::vector<uint8_t> data(size, 0);
+        uint32_t rng = seed;
+        size_t pos = 0;
+
+        while (pos < size) {
+            size_t section = std::min<size_t>(size - pos, 512 + NextRandom(rng) % 8192);
+            uint32_t kind = NextRandom(rng) % 10;
+
+            if (kind < 4) {
+                // Unused pool slots and padding
+            } else if (kind < 8) {
+                // Pool of fixed-size records (vehicles, peds, pickups, garages...)
+                size_t recordSize = 16 + NextRandom(rng) % 96;
+                std::vector<uint8_t> record(recordSize);
+                for (uint8_t& b : record) b = (uint8_t)NextRandom(rng);
+                for (size_t i = 0; i < section; i++) {
+                    size_t field = i % recordSize;
+                    data[pos + i] = record[field];
+                    if (field < 8 && (i / recordSize) % 3 == 0) data[pos + i] ^= (uint8_t)(i / recordSize);
+                }
+            } else {
+                // High-entropy data
+                for (size_t i = 0; i < section; i++) data[pos + i] = (uint8_t)NextRandom(rng);
+            }
+            pos += section;
+        }
+        return data;
+    }
+
+} // namespace Synthetic
+
+bool LoadFile(const char* path, Payload& out) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size <= 0) {
+        fclose(file);
+        return false;
+    }
+
+    out.name = path;
+    out.data.resize((size_t)size);
+    bool ok = fread(out.data.data(), 1, out.data.size(), file) == out.data.size();
+    fclose(file);
+    return ok;
+}
+
+double ElapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    int iterations = Config::DEFAULT_ITERATIONS;
+    std::vector<Payload> payloads;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            iterations = std::max(1, atoi(argv[++i]));
+        } else {
+            Payload payload;
+            if (!LoadFile(argv[i], payload)) {
+                fprintf(stderr, "compressbench: cannot read %s\n", argv[i]);
+                return 2;
+            }
+            payloads.push_back(std::move(payload));
+        }
+    }
+
+    if (payloads.empty()) {
+        payloads.push_back({ "synthetic III slot (64 KiB)", Synthetic::MakeSave(64 * 1024, 3) });
+        payloads.push_back({ "synthetic VC slot (200 KiB)", Synthetic::MakeSave(200 * 1024, 7) });
+        payloads.push_back({ "synthetic SA slot (202752 B)", Synthetic::MakeSave(202752, 11) });
+    }
+
+    printf("%-32s %10s %10s %7s %12s %12s %10s %10s\n",
+           "payload", "raw", "packed", "ratio", "compress ms", "expand ms", "comp MB/s", "exp MB/s");
+
+    int failures = 0;
+    for (const Payload& payload : payloads) {
+        const size_t rawSize = payload.data.size();
+        std::vector<uint8_t> packed(SaveCompression::MaxContainerSize(rawSize));
+        std::vector<uint8_t> unpacked(rawSize);
+
+        size_t packedSize = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            packedSize = SaveCompression::Compress(payload.data.data(), rawSize, packed.data(), packed.size());
+        }
+        double compressMs = ElapsedMs(start) / iterations;
+
+        bool ok = packedSize > 0;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations && ok; i++) {
+            ok = SaveCompression::Decompress(packed.data(), packedSize, unpacked.data(), unpacked.size());
+        }
+        double expandMs = ElapsedMs(start) / iterations;
+
+        ok = ok && memcmp(unpacked.data(), payload.data.data(), rawSize) == 0;
+        if (!ok) {
+            printf("%-32s ROUND TRIP FAILED\n", payload.name.c_str());
+            failures++;
+            continue;
+        }
+
+        double megabytes = (double)rawSize / (1024.0 * 1024.0);
+        printf("%-32s %10zu %10zu %6.1f%% %12.3f %12.3f %10.0f %10.0f\n",
+               payload.name.c_str(), rawSize, packedSize, 100.0 * (double)packedSize / (double)rawSize,
+               compressMs, expandMs, megabytes / (compressMs / 1000.0), megabytes / (expandMs / 1000.0));
+    }
+
+    return failures == 0 ? 0 : 1;
+}
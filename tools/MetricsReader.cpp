@@ -0,0 +1,158 @@
+// ============================================================================
+// MetricsReader - samples the mod's shared-memory metrics block
+// ============================================================================
+//
+// Reads the block published by the mod when PublishMetrics = 1 (see
+// source/Metrics.h) and prints one line per sample, or one JSON object per
+// line for dashboards. Reads never block the game: a sample that races a
+// write is simply retried.
+//
+// On Linux there is no game to attach to; tests/MetricsSimulator.cpp runs the
+// mod itself against the test harness and publishes the same block.
+//
+// Build:
+//   Linux:   g++ -O2 -std=c++17 tools/MetricsReader.cpp -o metricsreader   (older glibc: add -lrt)
+//   Windows: cl /O2 /std:c++17 /EHsc tools\MetricsReader.cpp
+//
+// Usage:
+//   metricsreader [-g III|VC|SA] [-i interval_ms] [-c samples] [--json]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "../source/Metrics.h"
+
+namespace Config {
+    constexpr int DEFAULT_INTERVAL_MS = 1000;
+}
+
+namespace Names {
+
+    // Must match Config::METRICS_MAPPING_NAME in source/Main.cpp. POSIX shm
+    // takes the same name, which is where MetricsSimulator publishes it.
+    void Build(const char* game, char* out, size_t outSize) {
+        snprintf(out, outSize, "Local\\Autosave.%s.Metrics", game);
+    }
+
+} // namespace Names
+
+namespace Output {
+
+    const char* PHASE_NAMES[Metrics::PHASE_COUNT] = { "postload", "autosave", "retry", "debug" };
+    const char* SLOT_NAMES[Metrics::SLOT_COUNT] = { "complete", "retry" };
+
+    // Overall container size as a percentage of the native size
+    double Ratio(const Metrics::CompressionCounters& c) {
+        return c.totalRawBytes ? 100.0 * (double)c.totalPackedBytes / (double)c.totalRawBytes : 0.0;
+    }
+
+    void PrintCompressionText(const char* name, const Metrics::CompressionCounters& c) {
+        printf(" | %s ok=%u fail=%u %.1f%% last slot %u %u->%u %.2f ms max %.2f ms", name, c.succeeded, c.failed,
+               Ratio(c), c.lastSlot, c.lastRawSize, c.lastPackedSize, c.lastDurationMs, c.maxDurationMs);
+    }
+
+    void PrintCompressionJson(const char* name, const Metrics::CompressionCounters& c) {
+        printf(",\"%s\":{\"succeeded\":%u,\"failed\":%u,\"totalRawBytes\":%llu,\"totalPackedBytes\":%llu,"
+               "\"last\":{\"slot\":%u,\"rawSize\":%u,\"packedSize\":%u,\"durationMs\":%.3f},\"maxDurationMs\":%.3f}",
+               name, c.succeeded, c.failed, (unsigned long long)c.totalRawBytes, (unsigned long long)c.totalPackedBytes,
+               c.lastSlot, c.lastRawSize, c.lastPackedSize, c.lastDurationMs, c.maxDurationMs);
+    }
+
+    void PrintText(const Metrics::Data& data) {
+        printf("frame %llu t=%u", (unsigned long long)data.frameCount, data.gameTimeMs);
+        for (uint32_t s = 0; s < Metrics::SLOT_COUNT; s++) {
+            const Metrics::SlotCounters& c = data.slots[s];
+            printf(" | %s a=%u ok=%u skip=%u fail=%u retries=%u failing=%u", SLOT_NAMES[s], c.attempted, c.succeeded,
+                   c.skipped, c.failed, c.retries, c.consecutiveFailures);
+        }
+        printf(" | last slot %u %.2f ms @%u", data.lastSaveSlot, data.lastSaveDurationMs, data.lastSaveGameTimeMs);
+        printf(" | prompts %u/%u loads %u", data.retryPromptsAccepted, data.retryPromptsShown, data.gamesLoaded);
+        PrintCompressionText("pack", data.pack);
+        PrintCompressionText("unpack", data.unpack);
+        printf(" | arena %u/%u", data.slotArenaHighWater, data.slotArenaCapacity);
+        printf(" | pending a=%u c=%u prompt=%u", data.pendingApproachSave, data.pendingMissionCompleteSave,
+               data.retryPromptVisible);
+        printf(" | us");
+        for (uint32_t p = 0; p < Metrics::PHASE_COUNT; p++) {
+            printf(" %s=%.1f", PHASE_NAMES[p], data.phaseCostAvgUs[p]);
+        }
+        printf("\n");
+    }
+
+    void PrintJson(const Metrics::Data& data) {
+        printf("{\"frame\":%llu,\"gameTimeMs\":%u,\"slots\":{", (unsigned long long)data.frameCount, data.gameTimeMs);
+        for (uint32_t s = 0; s < Metrics::SLOT_COUNT; s++) {
+            const Metrics::SlotCounters& c = data.slots[s];
+            printf("%s\"%s\":{\"attempted\":%u,\"succeeded\":%u,\"skipped\":%u,\"failed\":%u,\"retries\":%u,"
+                   "\"consecutiveFailures\":%u}", s ? "," : "", SLOT_NAMES[s], c.attempted, c.succeeded, c.skipped,
+                   c.failed, c.retries, c.consecutiveFailures);
+        }
+        printf("},\"lastSave\":{\"slot\":%u,\"durationMs\":%.3f,\"gameTimeMs\":%u}",
+               data.lastSaveSlot, data.lastSaveDurationMs, data.lastSaveGameTimeMs);
+        printf(",\"retryPrompts\":{\"shown\":%u,\"accepted\":%u}", data.retryPromptsShown, data.retryPromptsAccepted);
+        printf(",\"gamesLoaded\":%u", data.gamesLoaded);
+        PrintCompressionJson("pack", data.pack);
+        PrintCompressionJson("unpack", data.unpack);
+        printf(",\"slotArena\":{\"highWater\":%u,\"capacity\":%u}", data.slotArenaHighWater, data.slotArenaCapacity);
+        printf(",\"pending\":{\"approach\":%u,\"missionComplete\":%u,\"prompt\":%u}",
+               data.pendingApproachSave, data.pendingMissionCompleteSave, data.retryPromptVisible);
+        printf(",\"phaseUs\":{");
+        for (uint32_t p = 0; p < Metrics::PHASE_COUNT; p++) {
+            printf("%s\"%s\":{\"last\":%.2f,\"avg\":%.2f}", p ? "," : "", PHASE_NAMES[p],
+                   data.phaseCostUs[p], data.phaseCostAvgUs[p]);
+        }
+        printf("}}\n");
+    }
+
+} // namespace Output
+
+int main(int argc, char** argv) {
+    const char* game = "III";
+    int intervalMs = Config::DEFAULT_INTERVAL_MS;
+    long samples = -1;
+    bool json = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+            game = argv[++i];
+        } else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) {
+            intervalMs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            samples = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else {
+            fprintf(stderr, "usage: metricsreader [-g III|VC|SA] [-i interval_ms] [-c samples] [--json]\n");
+            return 2;
+        }
+    }
+
+    char name[128];
+    Names::Build(game, name, sizeof(name));
+
+    Metrics::Mapping mapping;
+    if (!mapping.Open(name)) {
+        fprintf(stderr, "metricsreader: %s not found (is the game running with PublishMetrics = 1?)\n", name);
+        return 1;
+    }
+
+    for (long n = 0; samples < 0 || n < samples; n++) {
+        if (n > 0) std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+
+        Metrics::Data data;
+        if (!Metrics::Read(*mapping.Get(), data)) {
+            fprintf(stderr, "metricsreader: no consistent sample (layout mismatch or writer stuck)\n");
+            continue;
+        }
+        if (json) {
+            Output::PrintJson(data);
+        } else {
+            Output::PrintText(data);
+        }
+        fflush(stdout);
+    }
+    return 0;
+}
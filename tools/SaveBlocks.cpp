@@ -0,0 +1,505 @@
+// ============================================================================
+// SaveBlocks - block-level change statistics for GTA III / VC / SA save files
+// ============================================================================
+//
+// Memory-maps a series of save files (e.g. successive copies of the autosave
+// slots), walks each file's block structure once while hashing it, then diffs
+// every file against the previous one block by block. Reports per-block size,
+// checksum and changed byte ranges, plus how many bytes a delta or
+// deduplicating format would need compared to storing every file in full.
+//
+// Build (Linux):
+//   g++ -O2 -std=c++17 -pthread tools/SaveBlocks.cpp -o saveblocks
+//
+// Usage:
+//   saveblocks [-j threads] [-s] [-a] <file|directory>...
+//     -j N   worker threads (default: hardware concurrency)
+//     -s     summary only, no per-block table
+//     -a     print every changed range instead of the first few per block
+//
+// Files given on the command line are compared in argument order. Files found
+// in a directory are compared oldest first (by modification time).
+
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ============================================================================
+// Configuration Constants
+// ============================================================================
+namespace Config {
+    constexpr size_t RANGE_MERGE_GAP = 8;         // Changed ranges closer than this are merged
+    constexpr size_t DELTA_RANGE_OVERHEAD = 8;    // Offset + length per range in a delta record
+    constexpr size_t DELTA_BLOCK_OVERHEAD = 4;    // Per changed block in a delta record
+    constexpr size_t RAW_CHUNK_SIZE = 4096;       // Fallback split for unrecognised files
+    constexpr int RANGES_SHOWN_PER_BLOCK = 4;
+}
+
+// ============================================================================
+// Data Types
+// ============================================================================
+enum class SaveFormat { SizePrefixed, Tagged, Raw };
+
+struct Block {
+    size_t offset = 0;   // Offset of the block payload in the file
+    size_t size = 0;
+    uint64_t hash = 0;
+};
+
+struct Range {
+    size_t begin;
+    size_t end;
+};
+
+struct SaveFile {
+    std::string path;
+    time_t mtime = 0;
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    SaveFormat format = SaveFormat::Raw;
+    bool checksumValid = false;
+    std::vector<Block> blocks;
+    std::string error;
+};
+
+struct BlockDiff {
+    size_t changedBytes = 0;
+    std::vector<Range> ranges;
+};
+
+struct FileDiff {
+    std::vector<BlockDiff> blocks;  // One per block of the newer file
+    size_t changedBytes = 0;
+    size_t deltaBytes = 0;
+};
+
+// ============================================================================
+// Utility Functions
+// ============================================================================
+namespace Utils {
+
+    uint64_t Fnv1a64(const uint8_t* data, size_t size) {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (size_t i = 0; i < size; i++) {
+            hash ^= data[i];
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    uint32_t ReadU32(const uint8_t* p) {
+        return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+    }
+
+    const char* FormatName(SaveFormat format) {
+        switch (format) {
+            case SaveFormat::SizePrefixed: return "III/VC";
+            case SaveFormat::Tagged:       return "SA";
+            default:                       return "raw";
+        }
+    }
+
+    // Runs fn(i) for i in [0, count) on up to threadCount threads
+    template <typename Fn>
+    void ParallelFor(size_t count, unsigned int threadCount, Fn fn) {
+        std::atomic<size_t> next{0};
+        auto worker = [&] {
+            for (size_t i = next++; i < count; i = next++) fn(i);
+        };
+        std::vector<std::thread> threads;
+        unsigned int spawn = (unsigned int)std::min<size_t>(threadCount, count);
+        for (unsigned int t = 1; t < spawn; t++) threads.emplace_back(worker);
+        worker();
+        for (std::thread& t : threads) t.join();
+    }
+
+} // namespace Utils
+
+// ============================================================================
+// Block Parsing
+// ============================================================================
+namespace Parser {
+
+    // SA: every block starts with the 5-byte "BLOCK" tag, the file is zero padded
+    // to a fixed size and ends with a 32-bit additive checksum.
+    bool ParseTagged(SaveFile& file) {
+        static const uint8_t TAG[] = { 'B', 'L', 'O', 'C', 'K' };
+        const size_t end = file.size - 4;
+        if (end < sizeof(TAG) || memcmp(file.data, TAG, sizeof(TAG)) != 0) return false;
+
+        size_t start = sizeof(TAG);
+        for (size_t i = start; i + sizeof(TAG) <= end; i++) {
+            if (file.data[i] == 'B' && memcmp(file.data + i, TAG, sizeof(TAG)) == 0) {
+                file.blocks.push_back({ start, i - start, 0 });
+                start = i + sizeof(TAG);
+                i = start - 1;
+            }
+        }
+        file.blocks.push_back({ start, end - start, 0 });
+        return true;
+    }
+
+    // III / VC: the file is a sequence of [uint32 size][payload] records followed
+    // by a 32-bit additive checksum.
+    bool ParseSizePrefixed(SaveFile& file) {
+        const size_t end = file.size - 4;
+        size_t pos = 0;
+        while (pos < end) {
+            if (end - pos < 4) return false;
+            size_t size = Utils::ReadU32(file.data + pos);
+            pos += 4;
+            if (size == 0 || size > end - pos) return false;
+            file.blocks.push_back({ pos, size, 0 });
+            pos += size;
+        }
+        return !file.blocks.empty();
+    }
+
+    void ParseRaw(SaveFile& file) {
+        file.blocks.clear();
+        for (size_t pos = 0; pos < file.size; pos += Config::RAW_CHUNK_SIZE) {
+            file.blocks.push_back({ pos, std::min(Config::RAW_CHUNK_SIZE, file.size - pos), 0 });
+        }
+    }
+
+    // Block layout from the headers, then one walk over the payload bytes
+    void Analyse(SaveFile& file) {
+        if (file.size < 8) {
+            file.format = SaveFormat::Raw;
+            ParseRaw(file);
+        } else if (ParseTagged(file)) {
+            file.format = SaveFormat::Tagged;
+        } else if (file.blocks.clear(), ParseSizePrefixed(file)) {
+            file.format = SaveFormat::SizePrefixed;
+        } else {
+            file.format = SaveFormat::Raw;
+            ParseRaw(file);
+        }
+
+        if (file.format == SaveFormat::Raw) {
+            for (Block& block : file.blocks) {
+                block.hash = Utils::Fnv1a64(file.data + block.offset, block.size);
+            }
+            return;
+        }
+
+        // Hash each payload and accumulate the game's additive checksum in the same walk
+        const size_t end = file.size - 4;
+        uint32_t sum = 0;
+        size_t pos = 0;
+        for (Block& block : file.blocks) {
+            for (; pos < block.offset; pos++) sum += file.data[pos];
+
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for (size_t blockEnd = block.offset + block.size; pos < blockEnd; pos++) {
+                sum += file.data[pos];
+                hash ^= file.data[pos];
+                hash *= 0x100000001b3ull;
+            }
+            block.hash = hash;
+        }
+        for (; pos < end; pos++) sum += file.data[pos];
+        file.checksumValid = (sum == Utils::ReadU32(file.data + end));
+    }
+
+} // namespace Parser
+
+// ============================================================================
+// Diffing
+// ============================================================================
+namespace Differ {
+
+    void DiffBlock(const uint8_t* oldData, size_t oldSize, const uint8_t* newData, size_t newSize, BlockDiff& out) {
+        size_t common = std::min(oldSize, newSize);
+        size_t i = 0;
+        while (i < common) {
+            if (oldData[i] == newData[i]) { i++; continue; }
+
+            size_t begin = i;
+            size_t lastDiff = i;
+            while (i < common && i - lastDiff <= Config::RANGE_MERGE_GAP) {
+                if (oldData[i] != newData[i]) lastDiff = i;
+                i++;
+            }
+            out.ranges.push_back({ begin, lastDiff + 1 });
+            out.changedBytes += lastDiff + 1 - begin;
+        }
+
+        // Growth counts as changed; shrinking only needs a new length
+        if (newSize > common) {
+            if (!out.ranges.empty() && common - out.ranges.back().end <= Config::RANGE_MERGE_GAP) {
+                out.changedBytes += newSize - out.ranges.back().end;
+                out.ranges.back().end = newSize;
+            } else {
+                out.ranges.push_back({ common, newSize });
+                out.changedBytes += newSize - common;
+            }
+        }
+    }
+
+    FileDiff Diff(const SaveFile& oldFile, const SaveFile& newFile) {
+        FileDiff diff;
+        diff.blocks.resize(newFile.blocks.size());
+
+        for (size_t b = 0; b < newFile.blocks.size(); b++) {
+            const Block& newBlock = newFile.blocks[b];
+            BlockDiff& blockDiff = diff.blocks[b];
+
+            if (b < oldFile.blocks.size()) {
+                const Block& oldBlock = oldFile.blocks[b];
+                if (oldBlock.hash == newBlock.hash && oldBlock.size == newBlock.size) continue;
+                DiffBlock(oldFile.data + oldBlock.offset, oldBlock.size,
+                          newFile.data + newBlock.offset, newBlock.size, blockDiff);
+            } else {
+                blockDiff.ranges.push_back({ 0, newBlock.size });
+                blockDiff.changedBytes = newBlock.size;
+            }
+
+            diff.changedBytes += blockDiff.changedBytes;
+            diff.deltaBytes += Config::DELTA_BLOCK_OVERHEAD + blockDiff.changedBytes +
+                               blockDiff.ranges.size() * Config::DELTA_RANGE_OVERHEAD;
+        }
+        return diff;
+    }
+
+} // namespace Differ
+
+// ============================================================================
+// File Handling
+// ============================================================================
+namespace Files {
+
+    void CollectInputs(const char* path, std::vector<SaveFile>& out) {
+        struct stat st;
+        if (stat(path, &st) != 0) {
+            fprintf(stderr, "saveblocks: cannot stat %s\n", path);
+            return;
+        }
+
+        if (!S_ISDIR(st.st_mode)) {
+            SaveFile file;
+            file.path = path;
+            file.mtime = st.st_mtime;
+            out.push_back(std::move(file));
+            return;
+        }
+
+        DIR* dir = opendir(path);
+        if (!dir) {
+            fprintf(stderr, "saveblocks: cannot open directory %s\n", path);
+            return;
+        }
+
+        std::vector<SaveFile> found;
+        while (dirent* entry = readdir(dir)) {
+            std::string child = std::string(path) + "/" + entry->d_name;
+            struct stat childSt;
+            if (stat(child.c_str(), &childSt) == 0 && S_ISREG(childSt.st_mode)) {
+                SaveFile file;
+                file.path = child;
+                file.mtime = childSt.st_mtime;
+                found.push_back(std::move(file));
+            }
+        }
+        closedir(dir);
+
+        std::sort(found.begin(), found.end(), [](const SaveFile& a, const SaveFile& b) {
+            return a.mtime != b.mtime ? a.mtime < b.mtime : a.path < b.path;
+        });
+        for (SaveFile& file : found) out.push_back(std::move(file));
+    }
+
+    bool Map(SaveFile& file) {
+        int fd = open(file.path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            file.error = "cannot open";
+            return false;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            file.error = "empty or unreadable";
+            close(fd);
+            return false;
+        }
+
+        void* mapped = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED) {
+            file.error = "mmap failed";
+            return false;
+        }
+
+        madvise(mapped, (size_t)st.st_size, MADV_SEQUENTIAL);
+        file.data = static_cast<const uint8_t*>(mapped);
+        file.size = (size_t)st.st_size;
+        return true;
+    }
+
+    void Unmap(SaveFile& file) {
+        if (file.data) munmap(const_cast<uint8_t*>(file.data), file.size);
+        file.data = nullptr;
+    }
+
+} // namespace Files
+
+// ============================================================================
+// Reporting
+// ============================================================================
+namespace Report {
+
+    void Append(std::string& out, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+    void Append(std::string& out, const char* fmt, ...) {
+        char line[512];
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(line, sizeof(line), fmt, args);
+        va_end(args);
+        out += line;
+    }
+
+    std::string FormatFile(const SaveFile& file, const FileDiff* diff, bool summaryOnly, bool allRanges) {
+        std::string out;
+        if (!file.error.empty()) {
+            Append(out, "%s: %s\n", file.path.c_str(), file.error.c_str());
+            return out;
+        }
+
+        Append(out, "%s: %zu bytes, %s, %zu blocks, checksum %s", file.path.c_str(), file.size,
+               Utils::FormatName(file.format), file.blocks.size(),
+               file.format == SaveFormat::Raw ? "n/a" : (file.checksumValid ? "ok" : "BAD"));
+        if (diff) {
+            Append(out, ", %zu bytes changed, delta %zu bytes\n", diff->changedBytes, diff->deltaBytes);
+        } else {
+            Append(out, " (baseline)\n");
+        }
+        if (summaryOnly) return out;
+
+        for (size_t b = 0; b < file.blocks.size(); b++) {
+            const Block& block = file.blocks[b];
+            Append(out, "  block %3zu  off %8zu  size %8zu  fnv %016llx", b, block.offset, block.size,
+                   (unsigned long long)block.hash);
+
+            if (!diff) {
+                out += '\n';
+                continue;
+            }
+
+            const BlockDiff& blockDiff = diff->blocks[b];
+            if (blockDiff.ranges.empty()) {
+                out += "  unchanged\n";
+                continue;
+            }
+
+            Append(out, "  %zu bytes in %zu ranges:", blockDiff.changedBytes, blockDiff.ranges.size());
+            size_t shown = allRanges ? blockDiff.ranges.size()
+                                     : std::min<size_t>(blockDiff.ranges.size(), Config::RANGES_SHOWN_PER_BLOCK);
+            for (size_t r = 0; r < shown; r++) {
+                Append(out, " [%zu,%zu)", blockDiff.ranges[r].begin, blockDiff.ranges[r].end);
+            }
+            if (shown < blockDiff.ranges.size()) out += " ...";
+            out += '\n';
+        }
+        return out;
+    }
+
+} // namespace Report
+
+// ============================================================================
+// Entry Point
+// ============================================================================
+int main(int argc, char** argv) {
+    unsigned int threadCount = std::max(1u, std::thread::hardware_concurrency());
+    bool summaryOnly = false;
+    bool allRanges = false;
+    std::vector<SaveFile> files;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            threadCount = std::max(1, atoi(argv[++i]));
+        } else if (strcmp(argv[i], "-s") == 0) {
+            summaryOnly = true;
+        } else if (strcmp(argv[i], "-a") == 0) {
+            allRanges = true;
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "saveblocks: unknown option %s\n", argv[i]);
+            return 2;
+        } else {
+            Files::CollectInputs(argv[i], files);
+        }
+    }
+
+    if (files.empty()) {
+        fprintf(stderr, "usage: saveblocks [-j threads] [-s] [-a] <file|directory>...\n");
+        return 2;
+    }
+
+    // Map and analyse every file, then diff each against its predecessor
+    Utils::ParallelFor(files.size(), threadCount, [&](size_t i) {
+        if (Files::Map(files[i])) Parser::Analyse(files[i]);
+    });
+
+    std::vector<FileDiff> diffs(files.size());
+    std::vector<int> previous(files.size(), -1);
+    for (size_t i = 0, last = (size_t)-1; i < files.size(); i++) {
+        if (!files[i].error.empty()) continue;
+        if (last != (size_t)-1) previous[i] = (int)last;
+        last = i;
+    }
+
+    std::vector<std::string> reports(files.size());
+    Utils::ParallelFor(files.size(), threadCount, [&](size_t i) {
+        const FileDiff* diff = nullptr;
+        if (previous[i] >= 0) {
+            diffs[i] = Differ::Diff(files[previous[i]], files[i]);
+            diff = &diffs[i];
+        }
+        reports[i] = Report::FormatFile(files[i], diff, summaryOnly, allRanges);
+    });
+
+    for (const std::string& report : reports) fputs(report.c_str(), stdout);
+
+    // Summary: full copies vs. first file + deltas vs. unique blocks only
+    size_t fullBytes = 0;
+    size_t deltaBytes = 0;
+    size_t dedupBytes = 0;
+    size_t analysed = 0;
+    std::unordered_set<uint64_t> seenBlocks;
+    for (size_t i = 0; i < files.size(); i++) {
+        const SaveFile& file = files[i];
+        if (!file.error.empty()) continue;
+
+        analysed++;
+        fullBytes += file.size;
+        deltaBytes += previous[i] >= 0 ? diffs[i].deltaBytes : file.size;
+        for (const Block& block : file.blocks) {
+            if (seenBlocks.insert(block.hash ^ block.size).second) dedupBytes += block.size;
+        }
+    }
+
+    if (analysed > 0 && fullBytes > 0) {
+        printf("\n%zu files, %zu bytes stored in full\n", analysed, fullBytes);
+        printf("  delta chain:       %zu bytes (saves %.1f%%)\n", deltaBytes,
+               100.0 * (double)(fullBytes - std::min(deltaBytes, fullBytes)) / (double)fullBytes);
+        printf("  block dedup:       %zu bytes (saves %.1f%%)\n", dedupBytes,
+               100.0 * (double)(fullBytes - std::min(dedupBytes, fullBytes)) / (double)fullBytes);
+    }
+
+    for (SaveFile& file : files) Files::Unmap(file);
+    return analysed == files.size() ? 0 : 1;
+}